@@ -0,0 +1,38 @@
+#include "dirtyrangeset.h"
+#include <algorithm>
+#include <iterator>
+
+DirtyRangeSet::DirtyRangeSet(size_t maxRanges)
+    : _maxRanges(std::max<size_t>(1, maxRanges)) {}
+
+void DirtyRangeSet::add(size_t begin, size_t end) {
+    if (begin >= end) return;
+
+    // First range that could touch [begin, end): the last one starting at or before begin
+    auto it = _ranges.upper_bound(begin);
+    if (it != _ranges.begin()) {
+        auto prev = std::prev(it);
+        if (prev->second >= begin) it = prev;
+    }
+    // Absorb every range overlapping or adjacent to the new one
+    while (it != _ranges.end() && it->first <= end) {
+        begin = std::min(begin, it->first);
+        end = std::max(end, it->second);
+        it = _ranges.erase(it);
+    }
+    _ranges.emplace(begin, end);
+
+    if (_ranges.size() > _maxRanges) {
+        // Scattered writes: one span over all of them is cheaper than many small repaints
+        size_t low = _ranges.begin()->first;
+        size_t high = _ranges.rbegin()->second;
+        _ranges.clear();
+        _ranges.emplace(low, high);
+    }
+}
+
+std::vector<DirtyRangeSet::Range> DirtyRangeSet::take() {
+    std::vector<Range> ranges(_ranges.begin(), _ranges.end());
+    _ranges.clear();
+    return ranges;
+}
@@ -0,0 +1,32 @@
+#ifndef DIRTYRANGESET_H
+#define DIRTYRANGESET_H
+
+#include <map>
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+// Set of half-open address intervals that still have to be repainted.
+// Overlapping and touching intervals are merged on insertion, so a burst of
+// single-word writes to neighbouring addresses collapses into one range.
+class DirtyRangeSet {
+public:
+    using Range = std::pair<size_t, size_t>; // [first, second)
+
+    // maxRanges bounds the bookkeeping: past it, everything collapses into one span
+    explicit DirtyRangeSet(size_t maxRanges = 64);
+
+    void add(size_t begin, size_t end);
+    bool empty() const { return _ranges.empty(); }
+    size_t rangeCount() const { return _ranges.size(); }
+    void clear() { _ranges.clear(); }
+
+    // Returns the merged ranges in address order and clears the set
+    std::vector<Range> take();
+
+private:
+    std::map<size_t, size_t> _ranges; // begin -> end, disjoint and non-adjacent
+    size_t _maxRanges;
+};
+
+#endif // DIRTYRANGESET_H
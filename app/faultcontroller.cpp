@@ -0,0 +1,320 @@
+#include "faultcontroller.h"
+#include "constants.h"
+#include <QMessageBox>
+#include <random>
+
+FaultController::FaultController(MemoryModel* mem,
+                                 QComboBox* faultCombo,
+                                 QLineEdit* addrEdit,
+                                 QLineEdit* lenEdit,
+                                 QDoubleSpinBox* flipProbSpin,
+                                 QLineEdit* seedEdit,
+                                 QLineEdit* aggressorEdit,
+                                 QLineEdit* triggerEdit,
+                                 QLineEdit* forcedEdit,
+                                 QLineEdit* retentionEdit,
+                                 QComboBox* neighborhoodCombo,
+                                 QLineEdit* sizeEdit,
+                                 QLineEdit* columnsEdit,
+                                 QComboBox* scrambleCombo,
+                                 QListWidget* faultList,
+                                 Logger* logger,
+                                 QObject* parent)
+    : QObject(parent), _mem(mem), _logger(logger),
+      _faultCombo(faultCombo), _addrEdit(addrEdit), _lenEdit(lenEdit), _flipProbSpin(flipProbSpin),
+      _seedEdit(seedEdit), _aggressorEdit(aggressorEdit), _triggerEdit(triggerEdit), _forcedEdit(forcedEdit),
+      _retentionEdit(retentionEdit), _neighborhoodCombo(neighborhoodCombo), _sizeEdit(sizeEdit),
+      _columnsEdit(columnsEdit), _scrambleCombo(scrambleCombo), _faultList(faultList) {
+    updateModelFields(static_cast<FaultModel>(_faultCombo->currentData().toInt()));
+}
+
+void FaultController::setMemoryModel(MemoryModel* mem) {
+    _mem = mem;
+}
+
+void FaultController::setLogger(Logger* logger) {
+    _logger = logger;
+}
+
+bool FaultController::validateInput(size_t& addr, size_t& len) {
+    if (!_mem || !_logger) return false;
+    
+    bool ok1 = false, ok2 = false;
+    addr = _addrEdit->text().toULongLong(&ok1);
+    len = _lenEdit->text().toULongLong(&ok2);
+
+    if (!ok1 || !ok2) {
+        if (_logger) {
+            _logger->error("Ошибка ввода: Адрес и длина должны быть числами.");
+        }
+        QMessageBox::warning(qobject_cast<QWidget*>(parent()), "Ошибка ввода", "Адрес и длина должны быть числами.");
+        return false;
+    }
+
+    if (addr >= _mem->size()) {
+        if (_logger) {
+            _logger->error(QString("Ошибка: Адрес %1 выходит за пределы памяти (0-%2)").arg(addr).arg(_mem->size() - 1));
+        }
+        QMessageBox::warning(qobject_cast<QWidget*>(parent()), "Ошибка", QString("Адрес должен быть в диапазоне 0-%1").arg(_mem->size() - 1));
+        return false;
+    }
+
+    if (len > _mem->size() - addr) {
+        len = _mem->size() - addr;
+        if (_logger) {
+            _logger->warning(QString("Длина уменьшена до %1 (выход за пределы памяти)").arg(len));
+        }
+    }
+
+    return true;
+}
+
+bool FaultController::validateLinked(InjectedFault& f, size_t& len) {
+    bool okSecond = false, okTrigger = false, okForced = false;
+    size_t second = _aggressorEdit->text().toULongLong(&okSecond);
+    Word trigger = _triggerEdit->text().toUInt(&okTrigger, 16);
+    Word forced = _forcedEdit->text().toUInt(&okForced, 16);
+    const bool needsSecond = f.model != FaultModel::AddressNoCell;
+    if ((needsSecond && !okSecond) || !okTrigger || !okForced) {
+        _logger->error("Ошибка ввода: второй адрес - десятичное число, триггер и значение - шестнадцатеричные.");
+        QMessageBox::warning(qobject_cast<QWidget*>(parent()), "Ошибка ввода",
+                             "Второй адрес должен быть десятичным числом, триггер и значение - шестнадцатеричными.");
+        return false;
+    }
+    if (needsSecond && second >= _mem->size()) {
+        _logger->error(QString("Ошибка: Второй адрес %1 выходит за пределы памяти (0-%2)").arg(second).arg(_mem->size() - 1));
+        QMessageBox::warning(qobject_cast<QWidget*>(parent()), "Ошибка",
+                             QString("Второй адрес должен быть в диапазоне 0-%1").arg(_mem->size() - 1));
+        return false;
+    }
+    // Every linked cell is indexed, so their number is bounded
+    const size_t maxLength = isCouplingFault(f.model) ? MAX_COUPLING_LENGTH : MAX_DECODER_FAULT_LENGTH;
+    size_t limit = std::min<size_t>(maxLength, needsSecond ? _mem->size() - second : len);
+    if (len > limit) {
+        len = limit;
+        _logger->warning(QString("Длина уменьшена до %1 (диапазон второго адреса, не более %2 ячеек)")
+                         .arg(len).arg(maxLength));
+    }
+    if (isCouplingFault(f.model)) {
+        f.aggressor_addr = second;
+        f.trigger_value = trigger;
+    } else if (needsSecond) {
+        f.target_addr = second;
+    }
+    f.forced_value = forced;
+    return true;
+}
+
+bool FaultController::validateRetention(InjectedFault& f) {
+    bool okTicks = false, okValue = false;
+    quint64 ticks = _retentionEdit->text().toULongLong(&okTicks);
+    Word decayed = _forcedEdit->text().toUInt(&okValue, 16);
+    if (!okTicks || ticks == 0 || !okValue) {
+        _logger->error("Ошибка ввода: время хранения - положительное число тактов, значение - шестнадцатеричное.");
+        QMessageBox::warning(qobject_cast<QWidget*>(parent()), "Ошибка ввода",
+                             "Время хранения должно быть положительным числом тактов, значение - шестнадцатеричным.");
+        return false;
+    }
+    f.retention_ticks = ticks;
+    f.forced_value = decayed;
+    return true;
+}
+
+bool FaultController::validateNeighborhood(InjectedFault& f, size_t& len) {
+    bool okPattern = false, okForced = false;
+    Word pattern = _triggerEdit->text().toUInt(&okPattern, 16);
+    Word forced = _forcedEdit->text().toUInt(&okForced, 16);
+    if (!okPattern || !okForced) {
+        _logger->error("Ошибка ввода: шаблон соседей и значение ячейки должны быть шестнадцатеричными.");
+        QMessageBox::warning(qobject_cast<QWidget*>(parent()), "Ошибка ввода",
+                             "Шаблон соседей и значение ячейки должны быть шестнадцатеричными.");
+        return false;
+    }
+    // Every base cell is indexed with its neighbors
+    if (len > MAX_NPSF_BASE_CELLS) {
+        len = MAX_NPSF_BASE_CELLS;
+        _logger->warning(QString("Длина уменьшена до %1 (не более %1 базовых ячеек)").arg(len));
+    }
+    f.trigger_value = pattern;
+    f.forced_value = forced;
+    f.neighborhood = _neighborhoodCombo ? _neighborhoodCombo->currentData().toInt() : 4;
+    return true;
+}
+
+void FaultController::updateModelFields(FaultModel model) {
+    bool coupling = isCouplingFault(model);
+    bool retention = model == FaultModel::Retention;
+    bool neighborhood = isNeighborhoodFault(model);
+    if (_aggressorEdit) {
+        _aggressorEdit->setEnabled(coupling || model == FaultModel::AddressRemap || model == FaultModel::AddressMulti);
+    }
+    if (_triggerEdit) _triggerEdit->setEnabled(coupling || neighborhood);
+    // CFin inverts the victim, so it has no forced value
+    if (_forcedEdit) {
+        _forcedEdit->setEnabled((coupling && model != FaultModel::CouplingInversion) || retention
+                                || model == FaultModel::AddressNoCell || model == FaultModel::NeighborhoodStatic);
+    }
+    if (_retentionEdit) _retentionEdit->setEnabled(retention);
+    if (_neighborhoodCombo) _neighborhoodCombo->setEnabled(neighborhood);
+    // Only the random models use the probability
+    _flipProbSpin->setEnabled(!actsOnWrite(model));
+}
+
+void FaultController::injectFault() {
+    if (!_mem || !_logger) return;
+    
+    InjectedFault f;
+    f.model = static_cast<FaultModel>(_faultCombo->currentData().toInt());
+    
+    size_t addr, len;
+    if (!validateInput(addr, len)) {
+        return;
+    }
+    if ((isCouplingFault(f.model) || isDecoderFault(f.model)) && !validateLinked(f, len)) {
+        return;
+    }
+    if (f.model == FaultModel::Retention && !validateRetention(f)) {
+        return;
+    }
+    if (isNeighborhoodFault(f.model) && !validateNeighborhood(f, len)) {
+        return;
+    }
+
+    f.addr = addr;
+    f.len = std::max<size_t>(1, len);
+    f.flip_probability = _flipProbSpin->value();
+
+    // Explicit seed reproduces a previous run; empty field picks a fresh random seed
+    QString seedText = _seedEdit ? _seedEdit->text().trimmed() : QString();
+    if (seedText.isEmpty()) {
+        std::random_device rd;
+        f.seed = (static_cast<uint64_t>(rd()) << 32) | rd();
+    } else {
+        bool ok = false;
+        f.seed = seedText.toULongLong(&ok);
+        if (!ok) {
+            if (_logger) {
+                _logger->error("Ошибка ввода: seed должен быть целым неотрицательным числом.");
+            }
+            QMessageBox::warning(qobject_cast<QWidget*>(parent()), "Ошибка ввода", "Seed должен быть целым неотрицательным числом.");
+            return;
+        }
+    }
+
+    if (!_mem->injectFault(f)) {
+        _logger->error(QString("Ошибка: внедрено максимальное число неисправностей (%1)").arg(MAX_FAULTS));
+        QMessageBox::warning(qobject_cast<QWidget*>(parent()), "Ошибка",
+                             QString("Можно внедрить не более %1 неисправностей. Удалите ненужные.").arg(MAX_FAULTS));
+        return;
+    }
+    refreshFaultList();
+    if (_logger) {
+        _logger->success(QString("Внедрена неисправность: %1 по адресу %2, длина=%3, seed=%4 (всего неисправностей: %5)")
+                   .arg(DataFormatter::getFaultModelName(f.model)).arg(addr).arg(f.len).arg(f.seed)
+                   .arg(_faultList ? _faultList->count() : 0));
+    }
+    emit faultInjected();
+}
+
+void FaultController::resetMemory() {
+    if (!_mem || !_logger) return;
+    
+    _mem->reset();
+    refreshFaultList();
+    if (_logger) {
+        _logger->info("Память сброшена. Все данные очищены, неисправности удалены.");
+    }
+    emit memoryReset();
+}
+
+void FaultController::removeSelectedFault() {
+    if (!_mem || !_logger || !_faultList) return;
+
+    int row = _faultList->currentRow();
+    if (row < 0) {
+        _logger->warning("Выберите неисправность в списке для удаления.");
+        return;
+    }
+    QString description = _faultList->item(row)->text();
+    if (_mem->removeFault(size_t(row))) {
+        refreshFaultList();
+        _logger->info(QString("Неисправность удалена: %1").arg(description));
+    }
+}
+
+void FaultController::clearFaults() {
+    if (!_mem || !_logger) return;
+
+    _mem->clearFaults();
+    refreshFaultList();
+    _logger->info("Все неисправности удалены. Данные памяти сохранены.");
+}
+
+void FaultController::refreshFaultList() {
+    if (!_mem || !_faultList) return;
+
+    _faultList->clear();
+    std::vector<InjectedFault> faults = _mem->faults();
+    for (size_t i = 0; i < faults.size(); ++i) {
+        _faultList->addItem(QString("%1. %2").arg(i + 1).arg(DataFormatter::describeFault(faults[i])));
+    }
+}
+
+void FaultController::resizeMemory() {
+    if (!_mem || !_logger || !_sizeEdit) return;
+
+    size_t words = 0;
+    if (!DataFormatter::parseWordCount(_sizeEdit->text(), words) || words == 0 || words > MAX_MEMORY_SIZE) {
+        if (_logger) {
+            _logger->error(QString("Ошибка ввода: размер памяти должен быть в диапазоне 1-%1 слов (допускаются суффиксы K/M/G).")
+                     .arg(MAX_MEMORY_SIZE));
+        }
+        QMessageBox::warning(qobject_cast<QWidget*>(parent()), "Ошибка ввода",
+                             QString("Размер памяти должен быть в диапазоне 1-%1 слов.").arg(MAX_MEMORY_SIZE));
+        return;
+    }
+
+    if (!_mem->resize(words)) {
+        return;
+    }
+    refreshFaultList();
+    if (_logger) {
+        _logger->info(QString("Размер памяти изменен: %1 слов (%2 МиБ). Данные очищены, неисправности удалены.")
+                .arg(words).arg(double(words) * sizeof(Word) / (1024.0 * 1024.0), 0, 'f', 1));
+    }
+    emit memoryResized();
+}
+
+void FaultController::applyTopology() {
+    if (!_mem || !_logger || !_columnsEdit || !_scrambleCombo) return;
+
+    bool ok = false;
+    size_t columns = _columnsEdit->text().toULongLong(&ok);
+    if (!ok || !MemoryTopology::isValidColumns(columns)) {
+        _logger->error(QString("Ошибка ввода: число столбцов должно быть степенью двойки (1-%1).").arg(MAX_TOPOLOGY_COLUMNS));
+        QMessageBox::warning(qobject_cast<QWidget*>(parent()), "Ошибка ввода",
+                             QString("Число столбцов должно быть степенью двойки (1-%1).").arg(MAX_TOPOLOGY_COLUMNS));
+        return;
+    }
+    AddressScramble scramble = static_cast<AddressScramble>(_scrambleCombo->currentData().toInt());
+    if (!_mem->setTopology(columns, scramble)) {
+        return;
+    }
+    std::shared_ptr<const MemoryTopology> topology = _mem->topology();
+    _logger->info(QString("Топология: %1 строк x %2 столбцов, перемешивание: %3")
+                  .arg(topology->rows()).arg(topology->columns()).arg(_scrambleCombo->currentText()));
+}
+
+void FaultController::onFaultModelChanged(int index) {
+    // Automatically set default probability based on fault model
+    FaultModel model = static_cast<FaultModel>(_faultCombo->itemData(index).toInt());
+    updateModelFields(model);
+    if (model == FaultModel::BitFlip) {
+        _flipProbSpin->setValue(0.010);
+    } else if (_flipProbSpin->isEnabled() && model != FaultModel::None) {
+        // For other fault models (StuckAt0, StuckAt1, OpenRead), use 0.110
+        _flipProbSpin->setValue(0.110);
+    }
+    // For FaultModel::None, keep current value
+}
+
@@ -0,0 +1,85 @@
+#ifndef FAULTCONTROLLER_H
+#define FAULTCONTROLLER_H
+
+#include <QObject>
+#include <QComboBox>
+#include <QLineEdit>
+#include <QDoubleSpinBox>
+#include <QListWidget>
+#include "types.h"
+#include "memorymodel.h"
+#include "logger.h"
+#include "dataformatter.h"
+
+class FaultController : public QObject {
+    Q_OBJECT
+public:
+    explicit FaultController(MemoryModel* mem,
+                            QComboBox* faultCombo,
+                            QLineEdit* addrEdit,
+                            QLineEdit* lenEdit,
+                            QDoubleSpinBox* flipProbSpin,
+                            QLineEdit* seedEdit,
+                            QLineEdit* aggressorEdit,
+                            QLineEdit* triggerEdit,
+                            QLineEdit* forcedEdit,
+                            QLineEdit* retentionEdit,
+                            QComboBox* neighborhoodCombo,
+                            QLineEdit* sizeEdit,
+                            QLineEdit* columnsEdit,
+                            QComboBox* scrambleCombo,
+                            QListWidget* faultList,
+                            Logger* logger,
+                            QObject* parent = nullptr);
+    
+    void setMemoryModel(MemoryModel* mem);
+    void setLogger(Logger* logger);
+    
+public slots:
+    void injectFault();
+    void resetMemory();
+    void resizeMemory();
+    void applyTopology();
+    void removeSelectedFault();
+    void clearFaults();
+    void refreshFaultList();
+    void onFaultModelChanged(int index);
+    
+signals:
+    void faultInjected();
+    void memoryReset();
+    void memoryResized();
+    
+private:
+    bool validateInput(size_t& addr, size_t& len);
+    // Coupling and decoder faults: second address range (aggressor or decoder target) and
+    // trigger/forced values; clips len to the second range
+    bool validateLinked(InjectedFault& f, size_t& len);
+    bool validateRetention(InjectedFault& f);
+    // Neighborhood faults: pattern/forced values and neighborhood size; clips len to the index limit
+    bool validateNeighborhood(InjectedFault& f, size_t& len);
+    // Enables the parameter fields used by the model
+    void updateModelFields(FaultModel model);
+    
+    MemoryModel* _mem;
+    Logger* _logger;
+    
+    // UI elements (not owned)
+    QComboBox* _faultCombo;
+    QLineEdit* _addrEdit;
+    QLineEdit* _lenEdit;
+    QDoubleSpinBox* _flipProbSpin;
+    QLineEdit* _seedEdit;
+    QLineEdit* _aggressorEdit;
+    QLineEdit* _triggerEdit;
+    QLineEdit* _forcedEdit;
+    QLineEdit* _retentionEdit;
+    QComboBox* _neighborhoodCombo;
+    QLineEdit* _sizeEdit;
+    QLineEdit* _columnsEdit;
+    QComboBox* _scrambleCombo;
+    QListWidget* _faultList;
+};
+
+#endif // FAULTCONTROLLER_H
+
@@ -0,0 +1,70 @@
+#include "mainwindow.h"
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QDebug>
+#include <memorytester.h>
+#include "types.h"
+#include "thememanager.h"
+#include "constants.h"
+#include "dataformatter.h"
+#include "marchtest.h"
+#include "testresultset.h"
+#include "tracer.h"
+
+int main(int argc, char** argv) {
+    // Set up debug message pattern for better diagnostics
+    qSetMessagePattern("[%{time h:mm:ss.zzz} %{type} %{file}:%{line}] %{message}");
+    
+    qDebug() << "Application starting...";
+    QApplication app(argc, argv);
+    qDebug() << "QApplication created";
+    qRegisterMetaType<MarchAlgorithm>("MarchAlgorithm");
+    qRegisterMetaType<TestExecutionMode>("TestExecutionMode");
+    qRegisterMetaType<TestResultsPtr>("TestResultsPtr");
+    // Register size_t for use in queued connections
+    qRegisterMetaType<size_t>("size_t");
+    // Register Theme enum for use in queued connections (used in themeChanged signal)
+    qRegisterMetaType<Theme>("Theme");
+    qDebug() << "Meta types registered";
+    
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Цифровой двойник ОЗУ — Тестбенч");
+    parser.addHelpOption();
+    QCommandLineOption memorySizeOption(QStringList() << "m" << "memory-size",
+        QString("Размер памяти в словах (1-%1), допускаются суффиксы K/M/G.").arg(MAX_MEMORY_SIZE),
+        "words", QString::number(DEFAULT_MEMORY_SIZE));
+    QCommandLineOption traceOption("trace",
+        "Записать временную шкалу выполнения в файл (Chrome trace-event JSON: chrome://tracing, ui.perfetto.dev).",
+        "file");
+    parser.addOption(memorySizeOption);
+    parser.addOption(traceOption);
+    parser.process(app);
+
+    if (parser.isSet(traceOption)) {
+        Tracer::start(parser.value(traceOption));
+        Tracer::setThreadName("GUI");
+        qDebug() << "Tracing to" << Tracer::outputPath();
+    }
+
+    size_t memoryWords = DEFAULT_MEMORY_SIZE;
+    if (!DataFormatter::parseWordCount(parser.value(memorySizeOption), memoryWords)
+            || memoryWords == 0 || memoryWords > MAX_MEMORY_SIZE) {
+        qWarning() << "Invalid --memory-size value, using default" << DEFAULT_MEMORY_SIZE;
+        memoryWords = DEFAULT_MEMORY_SIZE;
+    }
+
+    qDebug() << "Creating MainWindow...";
+    MainWindow w(nullptr, memoryWords);
+    qDebug() << "MainWindow created";
+    
+    qDebug() << "Showing MainWindow...";
+    w.show();
+    qDebug() << "MainWindow shown, entering event loop";
+    
+    int code = app.exec();
+    QString traceError;
+    if (!Tracer::stop(&traceError)) {
+        qWarning() << traceError;
+    }
+    return code;
+}
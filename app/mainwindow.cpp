@@ -1,6 +1,7 @@
 #include "mainwindow.h"
 #include "tableitemdelegate.h"
 #include "constants.h"
+#include "tracer.h"
 #include <QtWidgets>
 #include <QMessageBox>
 #include <QHeaderView>
@@ -14,7 +15,7 @@
 #include <cmath>
 #include <set>
 
-MainWindow::MainWindow(QWidget* parent)
+MainWindow::MainWindow(QWidget* parent, size_t memoryWords)
     : QMainWindow(parent), _dataChangedConnected(true) {
     qDebug() << "MainWindow constructor: start";
     setWindowTitle("Цифровой двойник ОЗУ — 350504 Витовт Даник Маша Настя");
@@ -22,7 +23,7 @@ MainWindow::MainWindow(QWidget* parent)
     qDebug() << "MainWindow: window title and size set";
 
     qDebug() << "MainWindow: creating MemoryModel...";
-    _mem = new MemoryModel(DEFAULT_MEMORY_SIZE, this);
+    _mem = new MemoryModel(memoryWords, this);
     qDebug() << "MainWindow: MemoryModel created";
     
     qDebug() << "MainWindow: creating TesterWorker...";
@@ -40,6 +41,36 @@ MainWindow::MainWindow(QWidget* parent)
     _faultGroup = new QGroupBox("Управление неисправностями");
     QVBoxLayout* faultLayout = new QVBoxLayout;
 
+    QHBoxLayout* sizeLayout = new QHBoxLayout;
+    sizeLayout->addWidget(new QLabel("Размер памяти (слов):"));
+    _sizeEdit = new QLineEdit(QString::number(memoryWords));
+    _sizeEdit->setToolTip(QString("Количество 32-битных слов (1-%1), допускаются суффиксы K/M/G, например 256M").arg(MAX_MEMORY_SIZE));
+    _sizeEdit->setValidator(new QRegularExpressionValidator(QRegularExpression("\\d{1,10}[KkMmGg]?"), this));
+    _resizeBtn = new QPushButton("Применить");
+    _resizeBtn->setToolTip("Изменить размер памяти (данные и неисправности будут удалены)");
+    sizeLayout->addWidget(_sizeEdit);
+    sizeLayout->addWidget(_resizeBtn);
+    faultLayout->addLayout(sizeLayout);
+
+    // Physical rows x columns layout: neighbors of the NPSF base cells
+    QHBoxLayout* topologyLayout = new QHBoxLayout;
+    topologyLayout->addWidget(new QLabel("Столбцов в строке:"));
+    _columnsEdit = new QLineEdit(QString::number(DEFAULT_TOPOLOGY_COLUMNS));
+    _columnsEdit->setToolTip(QString("Число слов в физической строке матрицы - степень двойки (1-%1); "
+                                     "определяет соседей ячеек для неисправностей NPSF").arg(MAX_TOPOLOGY_COLUMNS));
+    _columnsEdit->setValidator(new QRegularExpressionValidator(QRegularExpression("\\d{1,5}"), this));
+    topologyLayout->addWidget(_columnsEdit);
+    _scrambleCombo = new QComboBox;
+    _scrambleCombo->addItem("Без перемешивания", (int)AddressScramble::None);
+    _scrambleCombo->addItem("Обратный порядок битов столбца", (int)AddressScramble::ColumnReverse);
+    _scrambleCombo->addItem("Перестановка строк 2↔3", (int)AddressScramble::RowTwist);
+    _scrambleCombo->setToolTip("Перемешивание адресов: как логический адрес отображается на физическую строку и столбец");
+    topologyLayout->addWidget(_scrambleCombo);
+    _topologyBtn = new QPushButton("Применить");
+    _topologyBtn->setToolTip("Изменить топологию (данные и неисправности сохраняются)");
+    topologyLayout->addWidget(_topologyBtn);
+    faultLayout->addLayout(topologyLayout);
+
     QHBoxLayout* faultModelLayout = new QHBoxLayout;
     faultModelLayout->addWidget(new QLabel("Модель неисправности:"));
     _faultCombo = new QComboBox;
@@ -48,6 +79,18 @@ MainWindow::MainWindow(QWidget* parent)
     _faultCombo->addItem("Stuck-at-1", (int)FaultModel::StuckAt1);
     _faultCombo->addItem("Bit-flip", (int)FaultModel::BitFlip);
     _faultCombo->addItem("Open (invalid read)", (int)FaultModel::OpenRead);
+    _faultCombo->addItem("CFin (инверсная связь)", (int)FaultModel::CouplingInversion);
+    _faultCombo->addItem("CFid (идемпотентная связь)", (int)FaultModel::CouplingIdempotent);
+    _faultCombo->addItem("CFst (связь по состоянию)", (int)FaultModel::CouplingState);
+    _faultCombo->addItem("TF↑ (нет перехода 0→1)", (int)FaultModel::TransitionUp);
+    _faultCombo->addItem("TF↓ (нет перехода 1→0)", (int)FaultModel::TransitionDown);
+    _faultCombo->addItem("DRF (неисправность хранения)", (int)FaultModel::Retention);
+    _faultCombo->addItem("AF: адрес без ячейки", (int)FaultModel::AddressNoCell);
+    _faultCombo->addItem("AF: адрес другой ячейки", (int)FaultModel::AddressRemap);
+    _faultCombo->addItem("AF: адрес нескольких ячеек", (int)FaultModel::AddressMulti);
+    _faultCombo->addItem("ANPSF (активная, соседство)", (int)FaultModel::NeighborhoodActive);
+    _faultCombo->addItem("PNPSF (пассивная, соседство)", (int)FaultModel::NeighborhoodPassive);
+    _faultCombo->addItem("SNPSF (статическая, соседство)", (int)FaultModel::NeighborhoodStatic);
     _faultCombo->setCurrentIndex(3); // Bit-flip по умолчанию
     _faultCombo->setToolTip("Выберите модель неисправности для внедрения в память");
     faultModelLayout->addWidget(_faultCombo);
@@ -56,8 +99,7 @@ MainWindow::MainWindow(QWidget* parent)
     QHBoxLayout* addrLayout = new QHBoxLayout;
     addrLayout->addWidget(new QLabel("Адрес (слово):"));
     _addrEdit = new QLineEdit("0");
-    _addrEdit->setToolTip("Адрес начала области с неисправностью (0-255)");
-    _addrEdit->setValidator(new QIntValidator(0, 255, this));
+    _addrEdit->setValidator(new QRegularExpressionValidator(QRegularExpression("\\d{1,12}"), this));
     addrLayout->addWidget(_addrEdit);
     faultLayout->addLayout(addrLayout);
 
@@ -65,7 +107,7 @@ MainWindow::MainWindow(QWidget* parent)
     lenLayout->addWidget(new QLabel("Длина (слов):"));
     _lenEdit = new QLineEdit(QString::number(DEFAULT_FAULT_LENGTH));
     _lenEdit->setToolTip("Количество слов с неисправностью");
-    _lenEdit->setValidator(new QIntValidator(1, static_cast<int>(MAX_MEMORY_SIZE), this));
+    _lenEdit->setValidator(new QRegularExpressionValidator(QRegularExpression("\\d{1,12}"), this));
     lenLayout->addWidget(_lenEdit);
     faultLayout->addLayout(lenLayout);
 
@@ -81,6 +123,54 @@ MainWindow::MainWindow(QWidget* parent)
     probLayout->addWidget(_flipProbSpin);
     faultLayout->addLayout(probLayout);
 
+    QHBoxLayout* seedLayout = new QHBoxLayout;
+    seedLayout->addWidget(new QLabel("Seed:"));
+    _seedEdit = new QLineEdit;
+    _seedEdit->setPlaceholderText("случайный");
+    _seedEdit->setToolTip("Seed генератора неисправности. Одинаковый seed воспроизводит те же искажения; пусто — случайный seed");
+    _seedEdit->setValidator(new QRegularExpressionValidator(QRegularExpression("\\d{1,20}"), this));
+    seedLayout->addWidget(_seedEdit);
+    faultLayout->addLayout(seedLayout);
+
+    // Coupling faults: victims [addr, addr+len) are coupled to aggressors [second, second+len);
+    // decoder faults: address addr+i selects cell second+i
+    QHBoxLayout* couplingLayout = new QHBoxLayout;
+    couplingLayout->addWidget(new QLabel("Второй адрес:"));
+    _aggressorEdit = new QLineEdit("0");
+    _aggressorEdit->setToolTip("Связь: адрес первой ячейки-агрессора, жертва addr+i связана с агрессором aggressor+i. "
+                               "Дешифратор: адрес addr+i выбирает ячейку target+i");
+    _aggressorEdit->setValidator(new QRegularExpressionValidator(QRegularExpression("\\d{1,12}"), this));
+    couplingLayout->addWidget(_aggressorEdit);
+    couplingLayout->addWidget(new QLabel("Триггер:"));
+    _triggerEdit = new QLineEdit("FFFFFFFF");
+    _triggerEdit->setToolTip("Значение агрессора (hex): переход в него (CFin, CFid) или состояние (CFst) активирует связь; "
+                             "для NPSF - значение всех соседей, образующее шаблон");
+    _triggerEdit->setValidator(new QRegularExpressionValidator(QRegularExpression("(0[xX])?[0-9A-Fa-f]{1,8}"), this));
+    couplingLayout->addWidget(_triggerEdit);
+    couplingLayout->addWidget(new QLabel("Значение:"));
+    _forcedEdit = new QLineEdit("0");
+    _forcedEdit->setToolTip("Значение (hex), которое связь записывает в жертву (CFid, CFst), "
+                            "которое читается из ячейки после распада (DRF) или по адресу без ячейки (AF), "
+                            "или которое хранит базовая ячейка при шаблоне (SNPSF)");
+    _forcedEdit->setValidator(new QRegularExpressionValidator(QRegularExpression("(0[xX])?[0-9A-Fa-f]{1,8}"), this));
+    couplingLayout->addWidget(_forcedEdit);
+    faultLayout->addLayout(couplingLayout);
+
+    QHBoxLayout* retentionLayout = new QHBoxLayout;
+    retentionLayout->addWidget(new QLabel("Время хранения (тактов):"));
+    _retentionEdit = new QLineEdit(QString::number(DEFAULT_RETENTION_TICKS));
+    _retentionEdit->setToolTip("DRF: через столько тактов модельного времени без записи ячейка теряет данные. "
+                               "Такт — один проход марш-элемента; элемент Del добавляет 1000 тактов");
+    _retentionEdit->setValidator(new QRegularExpressionValidator(QRegularExpression("\\d{1,12}"), this));
+    retentionLayout->addWidget(_retentionEdit);
+    retentionLayout->addWidget(new QLabel("Соседство:"));
+    _neighborhoodCombo = new QComboBox;
+    _neighborhoodCombo->addItem("4 соседа", 4);
+    _neighborhoodCombo->addItem("8 соседей", 8);
+    _neighborhoodCombo->setToolTip("NPSF: соседи базовой ячейки - по строке и столбцу (4) или также по диагоналям (8)");
+    retentionLayout->addWidget(_neighborhoodCombo);
+    faultLayout->addLayout(retentionLayout);
+
     QHBoxLayout* faultBtnLayout = new QHBoxLayout;
     _injectBtn = new QPushButton("Внедрить неисправность");
     _injectBtn->setToolTip("Внедрить выбранную неисправность в память");
@@ -94,6 +184,21 @@ MainWindow::MainWindow(QWidget* parent)
     _faultInfoLabel->setWordWrap(true);
     faultLayout->addWidget(_faultInfoLabel);
 
+    faultLayout->addWidget(new QLabel("Внедренные неисправности:"));
+    _faultList = new QListWidget;
+    _faultList->setToolTip("Все активные неисправности; перекрывающиеся применяются в порядке внедрения");
+    _faultList->setMaximumHeight(90);
+    faultLayout->addWidget(_faultList);
+
+    QHBoxLayout* faultListBtnLayout = new QHBoxLayout;
+    _removeFaultBtn = new QPushButton("Удалить выбранную");
+    _removeFaultBtn->setToolTip("Удалить выбранную неисправность из набора");
+    _clearFaultsBtn = new QPushButton("Удалить все");
+    _clearFaultsBtn->setToolTip("Удалить все неисправности, не очищая данные памяти");
+    faultListBtnLayout->addWidget(_removeFaultBtn);
+    faultListBtnLayout->addWidget(_clearFaultsBtn);
+    faultLayout->addLayout(faultListBtnLayout);
+
     _faultGroup->setLayout(faultLayout);
     topSplitter->addWidget(_faultGroup);
 
@@ -104,13 +209,37 @@ MainWindow::MainWindow(QWidget* parent)
     QHBoxLayout* algoLayout = new QHBoxLayout;
     algoLayout->addWidget(new QLabel("Алгоритм тестирования:"));
     _algoCombo = new QComboBox;
-    _algoCombo->addItem("Walking 1s", (int)TestAlgorithm::WalkingOnes);
-    _algoCombo->addItem("Walking 0s", (int)TestAlgorithm::WalkingZeros);
-    _algoCombo->addItem("March - simple", (int)TestAlgorithm::MarchSimple);
+    for (const MarchAlgorithm& algo : MarchLibrary::algorithms()) {
+        _algoCombo->addItem(algo.name, algo.id);
+    }
+    _algoCombo->addItem("Пользовательский (March-нотация)", QString("custom"));
     _algoCombo->setToolTip("Выберите алгоритм тестирования памяти");
     algoLayout->addWidget(_algoCombo);
     testLayout->addLayout(algoLayout);
 
+    QHBoxLayout* marchLayout = new QHBoxLayout;
+    marchLayout->addWidget(new QLabel("March-нотация:"));
+    _marchEdit = new QLineEdit("{⇕(w0); ⇑(r0,w1); ⇓(r1,w0); ⇕(r0)}");
+    _marchEdit->setToolTip("Описание пользовательского теста, например {up(w0); up(r0,w1); down(r1,w0); any(r0)}");
+    _marchEdit->setEnabled(false);
+    marchLayout->addWidget(_marchEdit);
+    testLayout->addLayout(marchLayout);
+
+    QHBoxLayout* modeLayout = new QHBoxLayout;
+    modeLayout->addWidget(new QLabel("Режим выполнения:"));
+    _modeCombo = new QComboBox;
+    _modeCombo->addItem("Демонстрация", (int)TestExecutionMode::Visual);
+    _modeCombo->addItem("Турбо (без задержек)", (int)TestExecutionMode::Turbo);
+    _modeCombo->setToolTip("Демонстрация — пошаговая анимация; Турбо — полная скорость для измерения производительности");
+    modeLayout->addWidget(_modeCombo);
+    modeLayout->addWidget(new QLabel("Потоков:"));
+    _threadSpin = new QSpinBox;
+    _threadSpin->setRange(1, MAX_TEST_THREADS);
+    _threadSpin->setValue(std::min(ParallelExecutor::defaultThreadCount(), MAX_TEST_THREADS));
+    _threadSpin->setToolTip("Число рабочих потоков в турбо-режиме (демонстрация всегда выполняется в одном потоке)");
+    modeLayout->addWidget(_threadSpin);
+    testLayout->addLayout(modeLayout);
+
     _testInfoLabel = new QLabel("");
     _testInfoLabel->setWordWrap(true);
     testLayout->addWidget(_testInfoLabel);
@@ -119,6 +248,12 @@ MainWindow::MainWindow(QWidget* parent)
     _startBtn = new QPushButton("Запустить тест");
     _startBtn->setToolTip("Запустить выбранный тест");
     testBtnLayout->addWidget(_startBtn);
+    _pauseBtn = new QPushButton("Пауза");
+    _pauseBtn->setToolTip("Приостановить тест");
+    testBtnLayout->addWidget(_pauseBtn);
+    _stopBtn = new QPushButton("Остановить");
+    _stopBtn->setToolTip("Остановить тест и показать частичные результаты");
+    testBtnLayout->addWidget(_stopBtn);
     testLayout->addLayout(testBtnLayout);
 
     _progress = new QProgressBar;
@@ -143,7 +278,7 @@ MainWindow::MainWindow(QWidget* parent)
     _statsGroup = new QGroupBox("Статистика");
     QVBoxLayout* statsLayout = new QVBoxLayout;
 
-    _totalAddressesLabel = new QLabel(QString("Всего адресов: %1").arg(DEFAULT_MEMORY_SIZE));
+    _totalAddressesLabel = new QLabel(QString("Всего адресов: %1").arg(memoryWords));
     _testedAddressesLabel = new QLabel("Протестировано: 0");
     _faultsFoundLabel = new QLabel("Найдено неисправностей: 0");
     _coverageLabel = new QLabel("Покрытие: 0%");
@@ -159,6 +294,19 @@ MainWindow::MainWindow(QWidget* parent)
     statsLayout->addWidget(_currentFaultModelLabel);
     statsLayout->addWidget(_currentAlgorithmLabel);
 
+    // Filled by StatisticsManager from the phase metrics of the last run
+    statsLayout->addWidget(new QLabel("Фазы теста:"));
+    _phaseTable = new QTableWidget(0, 8);
+    _phaseTable->setHorizontalHeaderLabels(QStringList() << "Элемент" << "Время" << "Слов/с" << "нс/оп"
+                                           << "Чтения" << "Записи" << "Неиспр." << "Ожидания блок.");
+    _phaseTable->horizontalHeaderItem(6)->setToolTip("Применений неисправностей при чтении");
+    _phaseTable->horizontalHeaderItem(7)->setToolTip("Ожидания блокировки памяти: количество / суммарное время всех потоков");
+    _phaseTable->verticalHeader()->setVisible(false);
+    _phaseTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    _phaseTable->setSelectionMode(QAbstractItemView::NoSelection);
+    _phaseTable->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+    statsLayout->addWidget(_phaseTable, 1);
+
     _statsGroup->setLayout(statsLayout);
     topSplitter->addWidget(_statsGroup);
 
@@ -178,8 +326,7 @@ MainWindow::MainWindow(QWidget* parent)
     QHBoxLayout* tableControlsLayout = new QHBoxLayout;
     tableControlsLayout->addWidget(new QLabel("Поиск адреса:"));
     _searchEdit = new QLineEdit;
-    _searchEdit->setPlaceholderText("Введите адрес (0-255)");
-    _searchEdit->setValidator(new QIntValidator(0, 255, this));
+    _searchEdit->setValidator(new QRegularExpressionValidator(QRegularExpression("\\d{1,12}"), this));
     _searchBtn = new QPushButton("Найти");
     _scrollToNextFaultBtn = new QPushButton("Следующая неисправность");
     _scrollToNextFaultBtn->setToolTip("Перейти к следующей обнаруженной неисправности (с циклическим поиском)");
@@ -189,11 +336,11 @@ MainWindow::MainWindow(QWidget* parent)
     tableControlsLayout->addStretch();
     memoryLayout->addLayout(tableControlsLayout);
 
-    _table = new QTableWidget;
-    _table->setColumnCount(6);
-    _table->setHorizontalHeaderLabels({"Адрес", "HEX", "Двоичное", "Десятичное", "Статус", "Тип неисправности"});
+    // Columns and contents come from MemoryTableModel (installed by MemoryTableManager)
+    _table = new QTableView;
     _table->verticalHeader()->setVisible(false);
     _table->setSelectionMode(QAbstractItemView::SingleSelection);
+    _table->setSelectionBehavior(QAbstractItemView::SelectRows);
     _table->setEditTriggers(QAbstractItemView::NoEditTriggers);
     _table->setAlternatingRowColors(false); // Отключаем автоматическое чередование, управляем цветами вручную
     _table->setSortingEnabled(false);
@@ -237,18 +384,19 @@ MainWindow::MainWindow(QWidget* parent)
     _statisticsManager = std::unique_ptr<StatisticsManager>(new StatisticsManager(
         _totalAddressesLabel, _testedAddressesLabel, _faultsFoundLabel, _coverageLabel,
         _testTimeLabel, _currentFaultModelLabel, _currentAlgorithmLabel,
-        _faultInfoLabel, _testInfoLabel, _algoCombo, _mem));
+        _faultInfoLabel, _testInfoLabel, _algoCombo, _phaseTable, _mem));
     _statisticsManager->setTheme(initialTheme);
     
     _faultController = std::unique_ptr<FaultController>(new FaultController(
-        _mem, _faultCombo, _addrEdit, _lenEdit, _flipProbSpin, _logger.get(), this));
+        _mem, _faultCombo, _addrEdit, _lenEdit, _flipProbSpin, _seedEdit, _aggressorEdit, _triggerEdit, _forcedEdit,
+        _retentionEdit, _neighborhoodCombo, _sizeEdit, _columnsEdit, _scrambleCombo, _faultList, _logger.get(), this));
     
     _testController = std::unique_ptr<TestController>(new TestController(
-        _worker.get(), _mem, _tableManager.get(), _algoCombo, _startBtn, _progress,
+        _worker.get(), _mem, _tableManager.get(), _algoCombo, _modeCombo, _marchEdit, _threadSpin, _startBtn, _pauseBtn, _stopBtn, _progress,
         _testInfoLabel, _currentAddrLabel, _expectedValueLabel, _readValueLabel,
         _logger.get(), this));
     
-    _resultsNavigator = std::unique_ptr<ResultsNavigator>(new ResultsNavigator(_table, _mem, _logger.get()));
+    _resultsNavigator = std::unique_ptr<ResultsNavigator>(new ResultsNavigator(_tableManager.get(), _mem, _logger.get()));
 
     bottomSplitter->addWidget(logWidget);
     bottomSplitter->setStretchFactor(0, 3);
@@ -275,9 +423,11 @@ MainWindow::MainWindow(QWidget* parent)
     QAction* algorithmsAction = helpMenu->addAction("Описание алгоритмов");
     connect(algorithmsAction, &QAction::triggered, this, [this]() {
         QString desc = "Описание алгоритмов тестирования:\n\n";
-        desc += "Walking 1s: Записывает единицу в каждый бит и проверяет чтение.\n";
-        desc += "Walking 0s: Записывает ноль в каждый бит и проверяет чтение.\n";
-        desc += "March - simple: Простой маршевый тест (запись 0, проверка 0, запись 1, проверка 1).\n";
+        for (const MarchAlgorithm& algo : MarchLibrary::algorithms()) {
+            desc += QString("%1 %2 (%3n): %4\n\n").arg(algo.name).arg(algo.notation)
+                        .arg(algo.opsPerWord()).arg(algo.description);
+        }
+        desc += DataFormatter::getMarchNotationHelp() + "\n";
         QMessageBox::information(this, "Описание алгоритмов", desc);
     });
 
@@ -317,21 +467,23 @@ MainWindow::MainWindow(QWidget* parent)
     // Connections - UI buttons
     connect(_injectBtn, &QPushButton::clicked, _faultController.get(), &FaultController::injectFault);
     connect(_resetBtn, &QPushButton::clicked, _faultController.get(), &FaultController::resetMemory);
+    connect(_resizeBtn, &QPushButton::clicked, _faultController.get(), &FaultController::resizeMemory);
+    connect(_topologyBtn, &QPushButton::clicked, _faultController.get(), &FaultController::applyTopology);
+    connect(_removeFaultBtn, &QPushButton::clicked, _faultController.get(), &FaultController::removeSelectedFault);
+    connect(_clearFaultsBtn, &QPushButton::clicked, _faultController.get(), &FaultController::clearFaults);
     connect(_startBtn, &QPushButton::clicked, _testController.get(), &TestController::startTest);
+    connect(_pauseBtn, &QPushButton::clicked, _testController.get(), &TestController::togglePause);
+    connect(_stopBtn, &QPushButton::clicked, _testController.get(), &TestController::stopTest);
     connect(_clearLogBtn, &QPushButton::clicked, this, &MainWindow::clearLog);
     connect(_scrollToNextFaultBtn, &QPushButton::clicked, this, [this]() {
         _resultsNavigator->scrollToNextFault(_lastResults);
     });
     connect(_searchBtn, &QPushButton::clicked, this, [this]() {
-        if (!_mem || !_table) return;
+        if (!_mem || !_tableManager) return;
         bool ok;
-        int addr = _searchEdit->text().toInt(&ok);
-        if (ok && addr >= 0 && addr < int(_mem->size())) {
-            _table->selectRow(addr);
-            QTableWidgetItem* item = _table->item(addr, 0);
-            if (item) {
-                _table->scrollToItem(item, QAbstractItemView::EnsureVisible);
-            }
+        qulonglong addr = _searchEdit->text().toULongLong(&ok);
+        if (ok && addr < _mem->size()) {
+            _tableManager->selectAddress(size_t(addr));
         }
     });
     
@@ -340,13 +492,11 @@ MainWindow::MainWindow(QWidget* parent)
     connect(_faultCombo, SIGNAL(currentIndexChanged(int)), _faultController.get(), SLOT(onFaultModelChanged(int)));
 
     // Worker signals - use QueuedConnection since _worker is in a different thread
-    connect(_worker.get(), &TesterWorker::progress, _progress, &QProgressBar::setValue, Qt::QueuedConnection);
-    connect(_worker.get(), &TesterWorker::progressDetail, _testController.get(), &TestController::updateProgressDetails, Qt::QueuedConnection);
     connect(_worker.get(), &TesterWorker::finished, _testController.get(), &TestController::onTestFinished, Qt::QueuedConnection);
 
     // Memory signals
     connect(_mem, &MemoryModel::dataChanged, this, &MainWindow::onTableDataChanged);
-    connect(_mem, &MemoryModel::faultInjected, this, &MainWindow::onFaultInjected);
+    connect(_mem, &MemoryModel::faultsChanged, this, &MainWindow::onFaultsChanged);
     connect(_mem, &MemoryModel::errorOccurred, this, [this](const QString& message) {
         if (_logger) {
             _logger->error(message);
@@ -354,14 +504,15 @@ MainWindow::MainWindow(QWidget* parent)
     });
     
     // Manager signals
-    connect(_faultController.get(), &FaultController::faultInjected, this, &MainWindow::onFaultInjected);
     connect(_faultController.get(), &FaultController::memoryReset, this, &MainWindow::onMemoryReset);
+    connect(_faultController.get(), &FaultController::memoryResized, this, &MainWindow::onMemoryResized);
     connect(_testController.get(), &TestController::testStarted, this, &MainWindow::onTestStarted);
     connect(_testController.get(), &TestController::testFinished, this, &MainWindow::onTestFinished);
     connect(_testController.get(), &TestController::testResultsUpdated, this, &MainWindow::onTestResultsUpdated);
     connect(_themeController.get(), &ThemeController::themeChanged, this, &MainWindow::onThemeChanged);
 
     // Initialize
+    updateAddressInputs();
     _tableManager->refreshTable(0, _mem->size());
     _statisticsManager->updateFaultInfo();
     _statisticsManager->updateStatistics();
@@ -394,7 +545,7 @@ MainWindow::~MainWindow() {
         // This prevents any signals from worker thread reaching this (partially destroyed) object
         disconnect(_worker.get(), nullptr, this, nullptr);
         
-        // Worker's destructor will handle thread cleanup (quit and wait)
+        // Worker's destructor cancels a running test, then quits and waits for its thread
         // No need to move back to main thread - Qt handles this automatically
         _worker.reset();
     }
@@ -406,17 +557,17 @@ void MainWindow::onTableDataChanged(size_t begin, size_t end) {
     }
 }
 
-void MainWindow::onFaultInjected() {
+void MainWindow::onFaultsChanged() {
     if (_statisticsManager) {
         _statisticsManager->updateFaultInfo();
     }
     if (_tableManager) {
-        _tableManager->refreshTable(0, _mem->size());
+        _tableManager->reloadTable();
     }
 }
 
 void MainWindow::onMemoryReset() {
-    _lastResults.clear();
+    _lastResults.reset();
     _progress->setValue(0);
     _currentAddrLabel->setText("Адрес: —");
     _expectedValueLabel->setText("Ожидается: —");
@@ -425,6 +576,7 @@ void MainWindow::onMemoryReset() {
     // Clear test results in managers (they handle their own internal state)
     if (_tableManager) {
         _tableManager->clearTestResults();
+        _tableManager->reloadTable();
     }
     if (_statisticsManager) {
         _statisticsManager->clearTestResults();
@@ -432,8 +584,23 @@ void MainWindow::onMemoryReset() {
     }
 }
 
+void MainWindow::onMemoryResized() {
+    // A resize wipes contents and faults just like a reset
+    onMemoryReset();
+    updateAddressInputs();
+}
+
+void MainWindow::updateAddressInputs() {
+    size_t maxAddr = _mem->size() > 0 ? _mem->size() - 1 : 0;
+    _addrEdit->setToolTip(QString("Адрес начала области с неисправностью (0-%1)").arg(maxAddr));
+    _searchEdit->setPlaceholderText(QString("Введите адрес (0-%1)").arg(maxAddr));
+}
+
 void MainWindow::onTestStarted() {
-    _lastResults.clear();
+    _lastResults.reset();
+    // The tester works on the current layout - no resizing while it runs
+    _resizeBtn->setEnabled(false);
+    _topologyBtn->setEnabled(false);
     // Disable table updates during test for performance
     if (_dataChangedConnected) {
         disconnect(_mem, &MemoryModel::dataChanged, this, &MainWindow::onTableDataChanged);
@@ -441,8 +608,10 @@ void MainWindow::onTestStarted() {
     }
 }
 
-void MainWindow::onTestFinished(const std::vector<TestResult>& results) {
+void MainWindow::onTestFinished(const TestResultsPtr& results) {
     _lastResults = results;
+    _resizeBtn->setEnabled(true);
+    _topologyBtn->setEnabled(true);
     
     // Re-enable table updates after test completion
     if (!_dataChangedConnected) {
@@ -465,7 +634,7 @@ void MainWindow::onTestFinished(const std::vector<TestResult>& results) {
     }
 }
 
-void MainWindow::onTestResultsUpdated(const std::vector<TestResult>& results) {
+void MainWindow::onTestResultsUpdated(const TestResultsPtr& results) {
     _lastResults = results;
     
     // Update statistics with test time from test controller
@@ -478,6 +647,7 @@ void MainWindow::onTestResultsUpdated(const std::vector<TestResult>& results) {
 
 void MainWindow::onThemeChanged(Theme theme) {
     qDebug() << "MainWindow::onThemeChanged: start, theme =" << static_cast<int>(theme);
+    TraceScope scope("theme change", "gui");
     // NOTE: Do NOT call applyTheme here - this slot is called FROM applyTheme!
     // We just need to update the managers with the new theme
     
@@ -2,6 +2,7 @@
 #define MAINWINDOW_H
 
 #include <QMainWindow>
+#include <QTableView>
 #include <QTableWidget>
 #include <QTextEdit>
 #include <QProgressBar>
@@ -9,7 +10,9 @@
 #include <QLineEdit>
 #include <QPushButton>
 #include <QDoubleSpinBox>
+#include <QSpinBox>
 #include <QGroupBox>
+#include <QListWidget>
 #include <QLabel>
 #include <QTimer>
 #include <QTime>
@@ -20,6 +23,7 @@
 #include <set>
 #include <vector>
 #include "types.h"
+#include "constants.h"
 #include "memorymodel.h"
 #include "testerworker.h"
 #include "thememanager.h"
@@ -36,20 +40,22 @@
 class MainWindow : public QMainWindow {
     Q_OBJECT
 public:
-    explicit MainWindow(QWidget* parent = nullptr);
+    explicit MainWindow(QWidget* parent = nullptr, size_t memoryWords = DEFAULT_MEMORY_SIZE);
     ~MainWindow();
 
 private slots:
     void clearLog();
     void onTableDataChanged(size_t begin, size_t end);
-    void onFaultInjected();
+    void onFaultsChanged();
     void onMemoryReset();
+    void onMemoryResized();
     void onTestStarted();
-    void onTestFinished(const std::vector<TestResult>& results);
-    void onTestResultsUpdated(const std::vector<TestResult>& results);
+    void onTestFinished(const TestResultsPtr& results);
+    void onTestResultsUpdated(const TestResultsPtr& results);
     void onThemeChanged(Theme theme);
 
 private:
+    void updateAddressInputs();
 
     MemoryModel* _mem;  // Owned by Qt parent (this)
     std::unique_ptr<TesterWorker> _worker;
@@ -72,12 +78,31 @@ private:
     QLineEdit* _addrEdit;
     QLineEdit* _lenEdit;
     QDoubleSpinBox* _flipProbSpin;
+    QLineEdit* _seedEdit;
+    QLineEdit* _aggressorEdit;
+    QLineEdit* _triggerEdit;
+    QLineEdit* _forcedEdit;
+    QLineEdit* _retentionEdit;
+    QComboBox* _neighborhoodCombo;
     QPushButton* _injectBtn;
     QPushButton* _resetBtn;
+    QLineEdit* _sizeEdit;
+    QPushButton* _resizeBtn;
+    QLineEdit* _columnsEdit;
+    QComboBox* _scrambleCombo;
+    QPushButton* _topologyBtn;
     QLabel* _faultInfoLabel;
+    QListWidget* _faultList;
+    QPushButton* _removeFaultBtn;
+    QPushButton* _clearFaultsBtn;
 
     QComboBox* _algoCombo;
+    QComboBox* _modeCombo;
+    QLineEdit* _marchEdit;
+    QSpinBox* _threadSpin;
     QPushButton* _startBtn;
+    QPushButton* _pauseBtn;
+    QPushButton* _stopBtn;
     QProgressBar* _progress;
     QLabel* _testInfoLabel;
     QLabel* _currentAddrLabel;
@@ -89,10 +114,11 @@ private:
     QLabel* _faultsFoundLabel;
     QLabel* _coverageLabel;
     QLabel* _testTimeLabel;
+    QTableWidget* _phaseTable;
     QLabel* _currentFaultModelLabel;
     QLabel* _currentAlgorithmLabel;
 
-    QTableWidget* _table;
+    QTableView* _table;
     TableItemDelegate* _tableDelegate;
     QTextEdit* _log;
     QLineEdit* _searchEdit;
@@ -107,7 +133,7 @@ private:
     QAction* _gurrenLagannAction;
     QAction* _cyberpunkAction;
 
-    std::vector<TestResult> _lastResults;
+    TestResultsPtr _lastResults;
     bool _dataChangedConnected;  // Track connection state
 };
 
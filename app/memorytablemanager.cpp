@@ -0,0 +1,151 @@
+#include "memorytablemanager.h"
+#include "logger.h"
+#include "constants.h"
+#include "tracer.h"
+#include <QHeaderView>
+
+MemoryTableManager::MemoryTableManager(QTableView* table, MemoryModel* mem, Logger* logger)
+    : _table(table), _mem(mem), _model(nullptr), _logger(logger), _currentTheme(Theme::DeusEx), _lastHighlightedAddr(0),
+      _dirty(TABLE_DIRTY_MAX_RANGES), _refreshTimer(nullptr) {
+    if (_table) {
+        _model = new MemoryTableModel(_mem, _table);
+        _table->setModel(_model);
+        // Uniform rows: the view never has to measure rows it does not paint
+        _table->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+
+        _refreshTimer = new QTimer(_table);
+        _refreshTimer->setSingleShot(true);
+        _refreshTimer->setInterval(TABLE_REFRESH_FRAME_MS);
+        QObject::connect(_refreshTimer, &QTimer::timeout, [this]() { flushPendingRefresh(); });
+    }
+}
+
+MemoryTableManager::~MemoryTableManager() {
+    // The timer's slot refers to this manager, which may go away before the view
+    delete _refreshTimer;
+}
+
+void MemoryTableManager::setMemoryModel(MemoryModel* mem) {
+    _mem = mem;
+    if (_table) {
+        MemoryTableModel* old = _model;
+        _model = new MemoryTableModel(_mem, _table);
+        _model->setTheme(_currentTheme);
+        _model->setTestResults(_lastResults);
+        _table->setModel(_model);
+        delete old;
+        _dirty.clear();
+    }
+}
+
+void MemoryTableManager::setTestResults(const TestResultsPtr& results) {
+    _lastResults = results;
+    if (_model) {
+        _model->setTestResults(results);
+    }
+}
+
+void MemoryTableManager::clearTestResults() {
+    _lastResults.reset();
+    // Refresh table to remove color highlighting from test results
+    if (_model) {
+        _model->setTestResults(_lastResults);
+    }
+}
+
+void MemoryTableManager::setTheme(Theme theme) {
+    _currentTheme = theme;
+    if (_model) {
+        _model->setTheme(theme);
+    }
+}
+
+void MemoryTableManager::setLogger(Logger* logger) {
+    _logger = logger;
+}
+
+void MemoryTableManager::refreshTable(size_t begin, size_t end) {
+    if (!_mem || !_model || begin >= end) return;
+    // Writes arrive one dataChanged per word; collect them and repaint once per frame
+    _dirty.add(begin, end);
+    if (_refreshTimer && !_refreshTimer->isActive()) {
+        _refreshTimer->start();
+    }
+}
+
+void MemoryTableManager::flushPendingRefresh() {
+    if (_refreshTimer) _refreshTimer->stop();
+    if (!_model || _dirty.empty()) return;
+    TraceScope scope("table refresh", "gui");
+    std::vector<DirtyRangeSet::Range> ranges = _dirty.take();
+    if (scope.active()) scope.setDetail(QString("диапазонов: %1").arg(ranges.size()));
+    // Cells are computed lazily by the model; only the visible part of each range is repainted
+    for (const DirtyRangeSet::Range& range : ranges) {
+        _model->refreshRange(range.first, range.second);
+    }
+}
+
+void MemoryTableManager::reloadTable() {
+    if (!_mem || !_model) return;
+    TraceScope scope("table reload", "gui");
+    // reload() repaints the whole window, which covers everything still queued
+    _dirty.clear();
+    if (_refreshTimer) _refreshTimer->stop();
+    _model->reload();
+}
+
+bool MemoryTableManager::selectAddress(size_t addr) {
+    if (!_table || !_model) return false;
+    int row = _model->rowForAddress(addr);
+    if (row < 0) return false;
+    QModelIndex index = _model->index(row, 0);
+    _table->setCurrentIndex(index);
+    _table->selectRow(row);
+    _table->scrollTo(index, QAbstractItemView::EnsureVisible);
+    return true;
+}
+
+bool MemoryTableManager::currentAddress(size_t& addr) const {
+    if (!_table || !_model) return false;
+    QModelIndex index = _table->currentIndex();
+    if (!index.isValid()) return false;
+    addr = _model->addressForRow(index.row());
+    return true;
+}
+
+void MemoryTableManager::highlightAddress(size_t addr) {
+    if (!_table || !_mem) return;
+    
+    if (addr < _mem->size()) {
+        selectAddress(addr);
+    }
+}
+
+void MemoryTableManager::scrollToAddress(size_t addr) {
+    if (!_table || !_mem || !_model) return;
+    
+    if (addr < _mem->size()) {
+        int row = _model->rowForAddress(addr);
+        if (row >= 0) {
+            _table->scrollTo(_model->index(row, 0), QAbstractItemView::EnsureVisible);
+        }
+    }
+}
+
+void MemoryTableManager::updateProgressHighlight(size_t addr, size_t& lastHighlightedAddr) {
+    if (!_table || !_mem || !_model) return;
+    
+    if (addr < _mem->size()) {
+        // Обновляем выделение только если адрес изменился
+        if (addr != lastHighlightedAddr) {
+            // The model repaints the previous and the current row (bold font, theme colors)
+            _model->setHighlightedAddress(addr);
+            lastHighlightedAddr = addr;
+
+            // Scroll only every N addresses for performance
+            if (addr % TABLE_SCROLL_INTERVAL == 0) {
+                scrollToAddress(addr);
+            }
+        }
+    }
+}
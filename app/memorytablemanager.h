@@ -0,0 +1,56 @@
+#ifndef MEMORYTABLEMANAGER_H
+#define MEMORYTABLEMANAGER_H
+
+#include <QTableView>
+#include <QTimer>
+#include <memory>
+#include "types.h"
+#include "memorymodel.h"
+#include "memorytablemodel.h"
+#include "thememanager.h"
+#include "testresultset.h"
+#include "dirtyrangeset.h"
+
+class Logger;
+
+// Owns the memory table model and drives the view: refreshes, selection, scrolling
+class MemoryTableManager {
+public:
+    explicit MemoryTableManager(QTableView* table, MemoryModel* mem, Logger* logger = nullptr);
+    ~MemoryTableManager();
+    
+    void setMemoryModel(MemoryModel* mem);
+    void setTestResults(const TestResultsPtr& results);
+    void clearTestResults();  // Clear test results and remove color highlighting
+    void setTheme(Theme theme);
+    void setLogger(Logger* logger);
+    
+    // Queues [begin, end) for repainting; ranges queued within one frame are merged
+    void refreshTable(size_t begin, size_t end);
+    // Repaints all queued ranges now
+    void flushPendingRefresh();
+    // Re-reads size and faults (after fault injection, reset or resize)
+    void reloadTable();
+    void highlightAddress(size_t addr);
+    void scrollToAddress(size_t addr);
+    void updateProgressHighlight(size_t addr, size_t& lastHighlightedAddr);
+
+    // Selects the row of addr (moving the table window if needed) and scrolls to it
+    bool selectAddress(size_t addr);
+    // Address of the selected row; false if nothing is selected
+    bool currentAddress(size_t& addr) const;
+    QTableView* view() const { return _table; }
+    
+private:
+    QTableView* _table;
+    MemoryModel* _mem;
+    MemoryTableModel* _model; // Owned by the view (Qt parent)
+    Logger* _logger;
+    Theme _currentTheme;
+    TestResultsPtr _lastResults;
+    size_t _lastHighlightedAddr;
+    DirtyRangeSet _dirty;
+    QTimer* _refreshTimer; // Single-shot frame timer, owned by the view
+};
+
+#endif // MEMORYTABLEMANAGER_H
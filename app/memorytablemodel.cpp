@@ -0,0 +1,213 @@
+#include "memorytablemodel.h"
+#include "constants.h"
+#include "dataformatter.h"
+#include <QBrush>
+#include <QStringList>
+#include <algorithm>
+
+MemoryTableModel::MemoryTableModel(MemoryModel* mem, QObject* parent)
+    : QAbstractTableModel(parent), _mem(mem), _colors(ThemeManager::getColors(Theme::DeusEx)),
+      _binaryFont("Courier", 9), _size(0), _base(0), _highlighted(0), _hasHighlight(false) {
+    if (_mem) {
+        _faults = _mem->faultSnapshot();
+        _size = _mem->size();
+    }
+}
+
+size_t MemoryTableModel::windowRows() const {
+    return std::min(_size - _base, TABLE_WINDOW_ROWS);
+}
+
+int MemoryTableModel::rowCount(const QModelIndex& parent) const {
+    return parent.isValid() ? 0 : int(windowRows());
+}
+
+int MemoryTableModel::columnCount(const QModelIndex& parent) const {
+    return parent.isValid() ? 0 : int(ColumnCount);
+}
+
+QVariant MemoryTableModel::headerData(int section, Qt::Orientation orientation, int role) const {
+    if (role != Qt::DisplayRole) return QVariant();
+    if (orientation == Qt::Vertical) return QString::number(addressForRow(section));
+    switch (section) {
+        case AddressColumn: return "Адрес";
+        case HexColumn: return "HEX";
+        case BinaryColumn: return "Двоичное";
+        case DecimalColumn: return "Десятичное";
+        case StatusColumn: return "Статус";
+        case FaultTypeColumn: return "Тип неисправности";
+        default: return QVariant();
+    }
+}
+
+MemoryTableModel::RowState MemoryTableModel::rowState(size_t addr) const {
+    RowState state;
+    state.faulty = _faults && _faults->isAddrFaulty(addr);
+    state.tested = _results && _results->isTested(addr);
+    state.failed = _results && _results->isFailed(addr);
+    return state;
+}
+
+QVariant MemoryTableModel::data(const QModelIndex& index, int role) const {
+    if (!_mem || !index.isValid() || size_t(index.row()) >= windowRows()) return QVariant();
+    const size_t addr = addressForRow(index.row());
+    const int column = index.column();
+
+    switch (role) {
+    case Qt::DisplayRole: {
+        if (column == AddressColumn) return QString::number(addr);
+        if (column == StatusColumn || column == FaultTypeColumn) {
+            RowState state = rowState(addr);
+            if (column == FaultTypeColumn) return faultTypeText(addr, state);
+            if (!state.tested) return "Не протестировано";
+            return state.failed ? "Неисправна" : "Исправна";
+        }
+        // Value columns: faults are applied on read, exactly as the tester sees the cell
+        Word value = _mem->read(addr);
+        if (column == HexColumn) return QString("0x%1").arg(value, 8, 16, QChar('0')).toUpper();
+        if (column == BinaryColumn) return DataFormatter::formatBinary(value);
+        return QString::number(value);
+    }
+    case Qt::TextAlignmentRole:
+        if (column == BinaryColumn) return int(Qt::AlignLeft | Qt::AlignVCenter);
+        if (column == AddressColumn || column == HexColumn || column == DecimalColumn) {
+            return int(Qt::AlignRight | Qt::AlignVCenter);
+        }
+        return QVariant();
+    case Qt::FontRole: {
+        bool bold = _hasHighlight && addr == _highlighted;
+        if (column == BinaryColumn) {
+            QFont font = _binaryFont;
+            font.setBold(bold);
+            return font;
+        }
+        if (bold) {
+            QFont font;
+            font.setBold(true);
+            return font;
+        }
+        return QVariant();
+    }
+    case Qt::BackgroundRole:
+        return background(addr, column, rowState(addr));
+    case Qt::ForegroundRole:
+        return foreground(addr, column, rowState(addr));
+    case Qt::ToolTipRole:
+        if (column == FaultTypeColumn) return faultTypeToolTip(addr, rowState(addr));
+        return QVariant();
+    case FailedRole:
+        return rowState(addr).failed;
+    default:
+        return QVariant();
+    }
+}
+
+QVariant MemoryTableModel::background(size_t addr, int column, const RowState& state) const {
+    // Failed tests have the highest priority and cover the whole row
+    if (state.failed) return QBrush(_colors.failedTestBg);
+    if (column == StatusColumn) {
+        return QBrush(state.tested ? _colors.statusPassedBg : _colors.statusUntestedBg);
+    }
+    if (column == FaultTypeColumn) return QVariant();
+    if (state.faulty && !state.tested) return QBrush(_colors.faultyNotTestedBg);
+    if (_hasHighlight && addr == _highlighted) {
+        return QBrush(addr % 2 == 0 ? _colors.tableBgEven : _colors.tableBgOdd);
+    }
+    if (state.tested) return QBrush(_colors.passedTestBg);
+    return QBrush(addr % 2 == 0 ? _colors.untestedBgEven : _colors.untestedBgOdd);
+}
+
+QVariant MemoryTableModel::foreground(size_t addr, int column, const RowState& state) const {
+    if (state.failed) return QBrush(_colors.failedTestText);
+    if (column == StatusColumn) {
+        return QBrush(state.tested ? _colors.statusPassedText : _colors.statusUntestedText);
+    }
+    if (column == FaultTypeColumn) {
+        if (state.faulty) return QBrush(_colors.faultyNotTestedText);
+        return QBrush(state.tested ? _colors.tableText : _colors.statusUntestedText);
+    }
+    if (state.faulty && !state.tested) return QBrush(_colors.faultyNotTestedText);
+    if (_hasHighlight && addr == _highlighted) return QBrush(_colors.tableText);
+    if (state.tested) return QBrush(_colors.passedTestText);
+    return QBrush(_colors.statusUntestedText);
+}
+
+QString MemoryTableModel::faultTypeText(size_t addr, const RowState& state) const {
+    if (state.faulty) {
+        // All faults covering the address, in injection order
+        const FaultSet& faults = _faults->faults;
+        const FaultSet::Segment* seg = faults.segmentAt(addr);
+        QStringList names;
+        for (const uint32_t* ref = faults.refsBegin(*seg); ref != faults.refsEnd(*seg); ++ref) {
+            names << DataFormatter::getFaultModelName(faults.faults()[*ref].model);
+        }
+        return names.join(", ");
+    }
+    if (state.failed) return "Обнаружена";
+    return "—";
+}
+
+QString MemoryTableModel::faultTypeToolTip(size_t addr, const RowState& state) const {
+    if (!state.failed) return QString();
+    const TestFailure* failure = _results->lastFailureAt(addr);
+    if (!failure) return QString();
+    return QString("Ожидалось: 0x%1, Прочитано: 0x%2")
+        .arg(failure->expected, 8, 16, QChar('0'))
+        .arg(failure->read, 8, 16, QChar('0'));
+}
+
+void MemoryTableModel::setTestResults(const TestResultsPtr& results) {
+    _results = results;
+    refreshRange(_base, _base + windowRows());
+}
+
+void MemoryTableModel::setTheme(Theme theme) {
+    _colors = ThemeManager::getColors(theme);
+    refreshRange(_base, _base + windowRows());
+}
+
+void MemoryTableModel::setHighlightedAddress(size_t addr) {
+    size_t previous = _highlighted;
+    bool hadHighlight = _hasHighlight;
+    _highlighted = addr;
+    _hasHighlight = true;
+    if (hadHighlight && previous != addr) refreshRange(previous, previous + 1);
+    refreshRange(addr, addr + 1);
+}
+
+void MemoryTableModel::reload() {
+    if (!_mem) return;
+    _faults = _mem->faultSnapshot();
+    size_t size = _mem->size();
+    if (size == _size) {
+        // Same layout: keep selection and scroll position, just repaint
+        refreshRange(_base, _base + windowRows());
+        return;
+    }
+    beginResetModel();
+    _size = size;
+    if (_base >= _size) _base = 0;
+    _hasHighlight = false;
+    endResetModel();
+}
+
+void MemoryTableModel::refreshRange(size_t begin, size_t end) {
+    // Only rows inside the window exist for the view; the rest is computed on demand later
+    size_t from = std::max(begin, _base);
+    size_t to = std::min(end, _base + windowRows());
+    if (from >= to) return;
+    emit dataChanged(index(int(from - _base), 0), index(int(to - 1 - _base), ColumnCount - 1));
+}
+
+int MemoryTableModel::rowForAddress(size_t addr) {
+    if (addr >= _size) return -1;
+    if (addr < _base || addr >= _base + windowRows()) {
+        // Center the window on the address (aligned to keep row numbers readable)
+        beginResetModel();
+        size_t half = TABLE_WINDOW_ROWS / 2;
+        _base = addr > half ? ((addr - half) & ~size_t(0xFFFF)) : 0;
+        if (_size > TABLE_WINDOW_ROWS) _base = std::min(_base, _size - TABLE_WINDOW_ROWS);
+        endResetModel();
+    }
+    return int(addr - _base);
+}
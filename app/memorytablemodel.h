@@ -0,0 +1,78 @@
+#ifndef MEMORYTABLEMODEL_H
+#define MEMORYTABLEMODEL_H
+
+#include <QAbstractTableModel>
+#include <QFont>
+#include <memory>
+#include "types.h"
+#include "memorymodel.h"
+#include "thememanager.h"
+#include "testresultset.h"
+
+// Virtual table over MemoryModel and the last test results.
+// Nothing is stored per row: text and colors are computed in data(), which the
+// view only calls for visible cells. Very large arrays are shown through a
+// window of at most TABLE_WINDOW_ROWS rows starting at baseAddress(); the window
+// moves when an address outside of it has to be shown.
+class MemoryTableModel : public QAbstractTableModel {
+    Q_OBJECT
+public:
+    enum Column {
+        AddressColumn,
+        HexColumn,
+        BinaryColumn,
+        DecimalColumn,
+        StatusColumn,
+        FaultTypeColumn,
+        ColumnCount
+    };
+
+    // Marks cells drawn with the failed-test highlighting (see TableItemDelegate)
+    static const int FailedRole = Qt::UserRole + 1;
+
+    explicit MemoryTableModel(MemoryModel* mem, QObject* parent = nullptr);
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+    void setTestResults(const TestResultsPtr& results);
+    void setTheme(Theme theme);
+    void setHighlightedAddress(size_t addr);
+
+    // Re-reads the fault configuration and the memory size (after injection/reset/resize)
+    void reload();
+    // Repaints the rows of [begin, end) that are inside the window
+    void refreshRange(size_t begin, size_t end);
+
+    size_t baseAddress() const { return _base; }
+    size_t addressForRow(int row) const { return _base + size_t(row); }
+    // Row of an address, moving the window if needed. -1 if the address does not exist.
+    int rowForAddress(size_t addr);
+
+private:
+    struct RowState {
+        bool faulty;
+        bool tested;
+        bool failed;
+    };
+    RowState rowState(size_t addr) const;
+    QVariant background(size_t addr, int column, const RowState& state) const;
+    QVariant foreground(size_t addr, int column, const RowState& state) const;
+    QString faultTypeText(size_t addr, const RowState& state) const;
+    QString faultTypeToolTip(size_t addr, const RowState& state) const;
+    size_t windowRows() const;
+
+    MemoryModel* _mem;
+    std::shared_ptr<const FaultSnapshot> _faults;
+    TestResultsPtr _results;
+    ThemeColors _colors;
+    QFont _binaryFont;
+    size_t _size;
+    size_t _base;
+    size_t _highlighted;
+    bool _hasHighlight;
+};
+
+#endif // MEMORYTABLEMODEL_H
@@ -0,0 +1,66 @@
+#include "resultsnavigator.h"
+
+ResultsNavigator::ResultsNavigator(MemoryTableManager* tableManager, MemoryModel* mem, Logger* logger)
+    : _tableManager(tableManager), _mem(mem), _logger(logger) {
+}
+
+void ResultsNavigator::setTableManager(MemoryTableManager* tableManager) {
+    _tableManager = tableManager;
+}
+
+void ResultsNavigator::setMemoryModel(MemoryModel* mem) {
+    _mem = mem;
+}
+
+void ResultsNavigator::setLogger(Logger* logger) {
+    _logger = logger;
+}
+
+void ResultsNavigator::scrollToNextFault(const TestResultsPtr& results, size_t currentAddr) {
+    if (!_tableManager || !_mem || !_logger) return;
+    QWidget* dialogParent = qobject_cast<QWidget*>(_tableManager->view()->parent());
+    
+    // Проверяем, были ли запущены тесты
+    if (!results || results->empty()) {
+        if (_logger) {
+            _logger->warning("Тесты еще не запускались. Сначала запустите тест памяти.");
+        }
+        QMessageBox::information(dialogParent, "Тесты не запущены", 
+                                "Тесты еще не запускались.\nСначала запустите тест памяти.");
+        return;
+    }
+    
+    // Если неисправностей нет
+    if (results->failures().empty()) {
+        if (_logger) {
+            _logger->warning("Неисправности не найдены тестами. Все проверки прошли успешно.");
+        }
+        QMessageBox::information(dialogParent, "Неисправности не найдены", 
+                                "Тестами не обнаружено неисправностей.\nВсе проверки прошли успешно.");
+        return;
+    }
+    
+    // Если есть выбранная строка, используем её адрес
+    size_t startAddr = currentAddr;
+    size_t selectedAddr = 0;
+    if (_tableManager->currentAddress(selectedAddr) && selectedAddr < _mem->size()) {
+        startAddr = selectedAddr;
+    }
+    
+    // Ищем следующий неисправный адрес строго после текущего; в конце переходим к началу
+    // (циклический поиск по битовой карте неисправных адресов)
+    size_t nextAddr = 0;
+    if (!results->nextFailedAddress(startAddr, nextAddr)) {
+        if (_logger) {
+            _logger->warning("Не удалось найти следующую неисправность.");
+        }
+        return;
+    }
+    
+    // Прокручиваем к найденной неисправности (окно таблицы сдвигается при необходимости)
+    if (_tableManager->selectAddress(nextAddr)) {
+        if (_logger) {
+            _logger->info(QString("Переход к следующей неисправности по адресу: %1").arg(nextAddr));
+        }
+    }
+}
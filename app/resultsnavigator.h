@@ -1,26 +1,26 @@
 #ifndef RESULTSNAVIGATOR_H
 #define RESULTSNAVIGATOR_H
 
-#include <QTableWidget>
 #include <QMessageBox>
 #include <vector>
-#include <set>
 #include "types.h"
+#include "testresultset.h"
 #include "memorymodel.h"
 #include "logger.h"
+#include "memorytablemanager.h"
 
 class ResultsNavigator {
 public:
-    explicit ResultsNavigator(QTableWidget* table, MemoryModel* mem, Logger* logger);
+    explicit ResultsNavigator(MemoryTableManager* tableManager, MemoryModel* mem, Logger* logger);
     
-    void setTableWidget(QTableWidget* table);
+    void setTableManager(MemoryTableManager* tableManager);
     void setMemoryModel(MemoryModel* mem);
     void setLogger(Logger* logger);
     
-    void scrollToNextFault(const std::vector<TestResult>& results, size_t currentAddr = 0);
+    void scrollToNextFault(const TestResultsPtr& results, size_t currentAddr = 0);
     
 private:
-    QTableWidget* _table;
+    MemoryTableManager* _tableManager;
     MemoryModel* _mem;
     Logger* _logger;
 };
@@ -0,0 +1,193 @@
+#include "statisticsmanager.h"
+#include "constants.h"
+#include "teststatistics.h"
+#include "tracer.h"
+
+StatisticsManager::StatisticsManager(QLabel* totalAddressesLabel,
+                                     QLabel* testedAddressesLabel,
+                                     QLabel* faultsFoundLabel,
+                                     QLabel* coverageLabel,
+                                     QLabel* testTimeLabel,
+                                     QLabel* currentFaultModelLabel,
+                                     QLabel* currentAlgorithmLabel,
+                                     QLabel* faultInfoLabel,
+                                     QLabel* testInfoLabel,
+                                     QComboBox* algoCombo,
+                                     QTableWidget* phaseTable,
+                                     MemoryModel* mem)
+    : _mem(mem), _currentTheme(Theme::DeusEx), _testTimeMsecs(0),
+      _totalAddressesLabel(totalAddressesLabel),
+      _testedAddressesLabel(testedAddressesLabel),
+      _faultsFoundLabel(faultsFoundLabel),
+      _coverageLabel(coverageLabel),
+      _testTimeLabel(testTimeLabel),
+      _currentFaultModelLabel(currentFaultModelLabel),
+      _currentAlgorithmLabel(currentAlgorithmLabel),
+      _faultInfoLabel(faultInfoLabel),
+      _testInfoLabel(testInfoLabel),
+      _algoCombo(algoCombo),
+      _phaseTable(phaseTable) {
+}
+
+void StatisticsManager::setMemoryModel(MemoryModel* mem) {
+    _mem = mem;
+}
+
+void StatisticsManager::setTestResults(const TestResultsPtr& results) {
+    _lastResults = results;
+}
+
+void StatisticsManager::clearTestResults() {
+    _lastResults.reset();
+    _testTimeMsecs = 0;
+    // Update statistics to reflect cleared state
+    updateStatistics();
+}
+
+void StatisticsManager::setTestTime(int msecs) {
+    _testTimeMsecs = msecs;
+}
+
+void StatisticsManager::setTheme(Theme theme) {
+    _currentTheme = theme;
+}
+
+void StatisticsManager::setAlgorithmCombo(QComboBox* algoCombo) {
+    _algoCombo = algoCombo;
+}
+
+void StatisticsManager::updateStatistics() {
+    if (!_mem) return;
+    TraceScope scope("statistics update", "gui");
+    
+    TestStatistics stats = TestStatistics::compute(_mem->size(), _lastResults.get(), _mem->faultSnapshot().get(),
+                                                   _testTimeMsecs);
+    _totalAddressesLabel->setText(QString("Всего адресов: %1").arg(stats.total_addresses));
+    _testedAddressesLabel->setText(QString("Протестировано: %1").arg(stats.tested_addresses));
+    _faultsFoundLabel->setText(QString("Найдено неисправностей: %1").arg(stats.failed_addresses));
+    _coverageLabel->setText(QString("Покрытие: %1%").arg(stats.coveragePercent(), 0, 'f', 1));
+
+    std::vector<InjectedFault> faults = _mem->faults();
+    if (faults.size() > 1) {
+        _currentFaultModelLabel->setText(QString("Текущая модель: %1 и ещё %2")
+                                         .arg(DataFormatter::getFaultModelName(faults.back().model))
+                                         .arg(faults.size() - 1));
+    } else {
+        FaultModel model = faults.empty() ? FaultModel::None : faults.back().model;
+        _currentFaultModelLabel->setText(QString("Текущая модель: %1").arg(DataFormatter::getFaultModelName(model)));
+    }
+    
+    if (_testTimeMsecs > 0) {
+        QString timeStr = QString("%1.%2 сек").arg(_testTimeMsecs / 1000).arg((_testTimeMsecs % 1000) / 100, 2, 10, QChar('0'));
+        _testTimeLabel->setText(QString("Время теста: %1").arg(timeStr));
+    }
+    
+    if (_algoCombo) {
+        _currentAlgorithmLabel->setText(QString("Текущий алгоритм: %1").arg(_algoCombo->currentText()));
+    }
+
+    updatePhaseMetrics();
+}
+
+void StatisticsManager::updatePhaseMetrics() {
+    if (!_phaseTable) return;
+
+    std::vector<PhaseMetrics> phases;
+    if (_lastResults) phases = _lastResults->phases();
+    _phaseTable->setRowCount(0);
+    if (phases.empty()) return;
+
+    PhaseMetrics total = PhaseMetrics::total(phases);
+    total.notation = "Итого";
+    // Throughput of the whole run: every element walks the full array once
+    total.words = phases.front().words;
+    phases.push_back(total);
+
+    _phaseTable->setRowCount(int(phases.size()));
+    for (size_t i = 0; i < phases.size(); ++i) {
+        const PhaseMetrics& p = phases[i];
+        const int row = int(i);
+        QStringList cells;
+        cells << p.notation
+              << DataFormatter::formatNanoseconds(p.elapsed_ns)
+              << DataFormatter::formatScaled(p.wordsPerSecond())
+              << QString::number(p.nsPerOperation(), 'f', 2)
+              << DataFormatter::formatScaled(double(p.reads))
+              << DataFormatter::formatScaled(double(p.writes))
+              << DataFormatter::formatScaled(double(p.fault_applications))
+              << QString("%1 / %2").arg(p.lock_waits).arg(DataFormatter::formatNanoseconds(p.lock_wait_ns));
+        for (int column = 0; column < cells.size(); ++column) {
+            QTableWidgetItem* item = new QTableWidgetItem(cells[column]);
+            item->setTextAlignment(column == 0 ? int(Qt::AlignLeft | Qt::AlignVCenter)
+                                               : int(Qt::AlignRight | Qt::AlignVCenter));
+            if (i + 1 == phases.size()) {
+                QFont font = item->font();
+                font.setBold(true);
+                item->setFont(font);
+            }
+            _phaseTable->setItem(row, column, item);
+        }
+    }
+}
+
+void StatisticsManager::updateFaultInfo() {
+    if (!_mem) return;
+    
+    std::vector<InjectedFault> faults = _mem->faults();
+    ThemeColors colors = ThemeManager::getColors(_currentTheme);
+    if (faults.empty()) {
+        _faultInfoLabel->setText("Неисправность не внедрена");
+        _faultInfoLabel->setStyleSheet(QString("padding: 5px; background-color: %1; border: 1px solid %2; color: %3;")
+                                       .arg(colors.bgSecondary.name())
+                                       .arg(colors.accent.name())
+                                       .arg(colors.text.name()));
+    } else {
+        // Details of the most recent fault, plus the size of the whole set
+        const InjectedFault& f = faults.back();
+        QString info = QString("Тип: %1\nАдрес: %2\nДлина: %3 слов")
+                       .arg(DataFormatter::getFaultModelName(f.model))
+                       .arg(f.addr)
+                       .arg(f.len);
+        if (f.model == FaultModel::BitFlip) {
+            info += QString("\nВероятность инверсии: %1%").arg(f.flip_probability * PROGRESS_MAX_PERCENT, 0, 'f', 1);
+        }
+        if (isCouplingFault(f.model)) {
+            info += QString("\nАгрессор: %1\nТриггер: %2").arg(f.aggressor_addr).arg(DataFormatter::formatHex(f.trigger_value));
+            if (f.model != FaultModel::CouplingInversion) {
+                info += QString("\nЗначение жертвы: %1").arg(DataFormatter::formatHex(f.forced_value));
+            }
+        } else if (f.model == FaultModel::Retention) {
+            info += QString("\nВремя хранения: %1 тактов\nЗначение после распада: %2")
+                    .arg(f.retention_ticks).arg(DataFormatter::formatHex(f.forced_value));
+        } else if (f.model == FaultModel::AddressNoCell) {
+            info += QString("\nЧтение: %1").arg(DataFormatter::formatHex(f.forced_value));
+        } else if (isDecoderFault(f.model)) {
+            info += QString("\nВыбирается ячейка: %1").arg(f.target_addr);
+        } else if (isNeighborhoodFault(f.model)) {
+            info += QString("\nСоседей: %1\nШаблон: %2").arg(f.neighborhood).arg(DataFormatter::formatHex(f.trigger_value));
+            if (f.model == FaultModel::NeighborhoodStatic) {
+                info += QString("\nЗначение ячейки: %1").arg(DataFormatter::formatHex(f.forced_value));
+            }
+        } else if (!isTransitionFault(f.model)) {
+            info += QString("\nSeed: %1").arg(f.seed);
+        }
+        if (faults.size() > 1) {
+            info += QString("\nВсего неисправностей: %1").arg(faults.size());
+        }
+        _faultInfoLabel->setText(info);
+        _faultInfoLabel->setStyleSheet(QString("padding: 5px; background-color: %1; border: 1px solid %2; color: %3;")
+                                       .arg(colors.faultyNotTestedBg.name())
+                                       .arg(colors.accent.name())
+                                       .arg(colors.text.name()));
+    }
+    updateStatistics();
+}
+
+void StatisticsManager::updateTestInfo() {
+    if (!_algoCombo) return;
+    
+    const MarchAlgorithm* algo = MarchLibrary::find(_algoCombo->currentData().toString());
+    QString desc = algo ? DataFormatter::getAlgorithmDescription(*algo) : DataFormatter::getMarchNotationHelp();
+    _testInfoLabel->setText(QString("Алгоритм: %1\n\n%2").arg(_algoCombo->currentText()).arg(desc));
+}
+
@@ -3,12 +3,14 @@
 
 #include <QLabel>
 #include <QComboBox>
+#include <QTableWidget>
 #include <memory>
 #include <vector>
 #include "types.h"
 #include "memorymodel.h"
 #include "thememanager.h"
 #include "dataformatter.h"
+#include "testresultset.h"
 
 class StatisticsManager {
 public:
@@ -22,10 +24,11 @@ public:
                      QLabel* faultInfoLabel,
                      QLabel* testInfoLabel,
                      QComboBox* algoCombo,
+                     QTableWidget* phaseTable,
                      MemoryModel* mem);
     
     void setMemoryModel(MemoryModel* mem);
-    void setTestResults(const std::vector<TestResult>& results);
+    void setTestResults(const TestResultsPtr& results);
     void clearTestResults();  // Clear test results and reset statistics
     void setTestTime(int msecs);
     void setTheme(Theme theme);
@@ -34,10 +37,12 @@ public:
     void updateStatistics();
     void updateFaultInfo();
     void updateTestInfo();
+    // Per-element timing and counters of the last run (one row per march element plus a total)
+    void updatePhaseMetrics();
     
 private:
     MemoryModel* _mem;
-    std::vector<TestResult> _lastResults;
+    TestResultsPtr _lastResults;
     Theme _currentTheme;
     int _testTimeMsecs;
     
@@ -52,6 +57,7 @@ private:
     QLabel* _faultInfoLabel;
     QLabel* _testInfoLabel;
     QComboBox* _algoCombo;
+    QTableWidget* _phaseTable;
 };
 
 #endif // STATISTICSMANAGER_H
@@ -0,0 +1,297 @@
+#include "testcontroller.h"
+#include "constants.h"
+#include <QMessageBox>
+#include <QMetaObject>
+
+TestController::TestController(TesterWorker* worker,
+                               MemoryModel* mem,
+                               MemoryTableManager* tableManager,
+                               QComboBox* algoCombo,
+                               QComboBox* modeCombo,
+                               QLineEdit* marchEdit,
+                               QSpinBox* threadSpin,
+                               QPushButton* startBtn,
+                               QPushButton* pauseBtn,
+                               QPushButton* stopBtn,
+                               QProgressBar* progress,
+                               QLabel* testInfoLabel,
+                               QLabel* currentAddrLabel,
+                               QLabel* expectedValueLabel,
+                               QLabel* readValueLabel,
+                               Logger* logger,
+                               QObject* parent)
+    : QObject(parent), _worker(worker), _mem(mem), _tableManager(tableManager), _logger(logger),
+      _testRunning(false), _pausedMsecs(0), _lastHighlightedAddr(0), _lastTestTimeMsecs(0),
+      _progressPoll(new QTimer(this)), _sampleVersion(0),
+      _algoCombo(algoCombo), _modeCombo(modeCombo), _marchEdit(marchEdit), _threadSpin(threadSpin), _startBtn(startBtn),
+      _pauseBtn(pauseBtn), _stopBtn(stopBtn), _progress(progress),
+      _testInfoLabel(testInfoLabel), _currentAddrLabel(currentAddrLabel),
+      _expectedValueLabel(expectedValueLabel), _readValueLabel(readValueLabel) {
+    // Progress is read at a fixed rate instead of being pushed per block,
+    // so a fast test cannot flood the event loop
+    _progressPoll->setInterval(PROGRESS_POLL_INTERVAL_MS);
+    connect(_progressPoll, &QTimer::timeout, this, &TestController::pollProgress);
+    updateRunButtons();
+}
+
+void TestController::setWorker(TesterWorker* worker) {
+    _worker = worker;
+}
+
+void TestController::setMemoryModel(MemoryModel* mem) {
+    _mem = mem;
+}
+
+void TestController::setTableManager(MemoryTableManager* tableManager) {
+    _tableManager = tableManager;
+}
+
+void TestController::setLogger(Logger* logger) {
+    _logger = logger;
+}
+
+void TestController::setTestRunning(bool running) {
+    _testRunning = running;
+    updateRunButtons();
+}
+
+void TestController::updateRunButtons() {
+    bool paused = _testRunning && _worker && _worker->isPaused();
+    if (_startBtn) {
+        _startBtn->setEnabled(!_testRunning);
+    }
+    if (_pauseBtn) {
+        _pauseBtn->setEnabled(_testRunning);
+        _pauseBtn->setText(paused ? "Продолжить" : "Пауза");
+        _pauseBtn->setToolTip(paused ? "Продолжить приостановленный тест" : "Приостановить тест");
+    }
+    if (_stopBtn) {
+        _stopBtn->setEnabled(_testRunning);
+    }
+}
+
+void TestController::startTest() {
+    if (!_mem || !_worker || !_logger) return;
+    
+    // Thread-safe check: prevent multiple test starts
+    if (_testRunning) {
+        if (_logger) {
+            _logger->warning("Тест уже выполняется. Дождитесь завершения.");
+        }
+        return;
+    }
+
+    // Additional safety check: ensure worker is ready
+    if (!_worker) {
+        if (_logger) {
+            _logger->error("Worker не инициализирован. Невозможно запустить тест.");
+        }
+        return;
+    }
+
+    // Additional safety checks for UI elements
+    if (!_algoCombo || !_modeCombo || !_startBtn || !_currentAddrLabel || !_expectedValueLabel || !_readValueLabel) {
+        if (_logger) {
+            _logger->error("UI элементы не инициализированы. Невозможно запустить тест.");
+        }
+        return;
+    }
+
+    MarchAlgorithm algo;
+    if (!selectedAlgorithm(algo)) {
+        return;
+    }
+    TestExecutionMode mode = static_cast<TestExecutionMode>(_modeCombo->currentData().toInt());
+    // Demonstration mode animates a single address at a time and always runs on one thread
+    int threads = (mode == TestExecutionMode::Turbo && _threadSpin) ? _threadSpin->value() : 1;
+    // Linked cells have to be visited in march order, so the tester runs those serially
+    if (threads > 1 && _mem && _mem->faultSnapshot()->faults.hasLinkedCells()) {
+        threads = 1;
+        if (_logger) {
+            _logger->info("Внедрены неисправности связи или дешифратора: тест выполняется в одном потоке.");
+        }
+    }
+    _testRunning = true;
+    _testTimer.start();
+    _pausedMsecs = 0;
+    _lastHighlightedAddr = 0;
+    // Must happen before run() is queued: a stop pressed right after start has to stick
+    _worker->prepareRun();
+    _finishedTrace.newRun();
+    _sampleVersion = 0;
+    updateRunButtons();
+
+    // Reset progress details
+    _currentAddrLabel->setText("Адрес: —");
+    _expectedValueLabel->setText("Ожидается: —");
+    _readValueLabel->setText("Прочитано: —");
+
+    if (_logger) {
+        _logger->info(QString("Запуск теста: %1 %2 (режим: %3, потоков: %4)").arg(algo.name).arg(algo.notation)
+                      .arg(_modeCombo->currentText()).arg(threads));
+    }
+    
+    emit testStarted();
+    _progressPoll->start();
+    QMetaObject::invokeMethod(_worker, "run", Qt::QueuedConnection, Q_ARG(MarchAlgorithm, algo),
+                              Q_ARG(TestExecutionMode, mode), Q_ARG(int, threads));
+}
+
+void TestController::togglePause() {
+    if (!_testRunning || !_worker) return;
+    if (_worker->isPaused()) {
+        _pausedMsecs += int(_pauseTimer.elapsed());
+        _worker->resume();
+        if (_logger) {
+            _logger->info("Тест продолжен.");
+        }
+    } else {
+        _pauseTimer.start();
+        _worker->pause();
+        if (_logger) {
+            _logger->info("Тест приостановлен.");
+        }
+    }
+    updateRunButtons();
+}
+
+void TestController::stopTest() {
+    if (!_testRunning || !_worker) return;
+    if (_worker->isPaused()) {
+        _pausedMsecs += int(_pauseTimer.elapsed());
+    }
+    // The worker finishes the blocks in flight and reports partial results through finished()
+    _worker->cancel();
+    if (_stopBtn) {
+        _stopBtn->setEnabled(false);
+    }
+    if (_pauseBtn) {
+        _pauseBtn->setEnabled(false);
+    }
+    if (_logger) {
+        _logger->warning("Остановка теста...");
+    }
+}
+
+void TestController::onTestFinished(const TestResultsPtr& results) {
+    TraceScope scope("deliver finished", "gui");
+    Tracer::flowEnd("finished", _finishedTrace.next());
+    // Thread-safe: this slot is called from main thread via Qt signal/slot mechanism
+    // Reset test state atomically
+    if (_testRunning && _worker && _worker->isPaused()) {
+        _pausedMsecs += int(_pauseTimer.elapsed());
+    }
+    _testRunning = false;
+    _progressPoll->stop();
+    pollProgress(); // Final state: 100% or where a cancelled run stopped
+    updateRunButtons();
+    
+    size_t fails = results ? results->failedCount() : 0;
+    quint64 reads = results ? results->readCount() : 0;
+    size_t failedReads = results ? results->failures().size() : 0;
+
+    int elapsed = int(_testTimer.elapsed()) - _pausedMsecs;
+    _lastTestTimeMsecs = elapsed;
+    QString timeStr = QString("%1.%2 сек").arg(elapsed / 1000).arg((elapsed % 1000) / 100, 2, 10, QChar('0'));
+
+    if (results && results->cancelled()) {
+        if (_logger) {
+            _logger->warning(QString("Тест остановлен. Частичные результаты: проверено адресов: %1, проверок: %2, неисправных адресов: %3. Время: %4")
+                       .arg(results->testedCount()).arg(reads).arg(fails).arg(timeStr));
+        }
+    } else if (fails == 0) {
+        if (_logger) {
+            _logger->success(QString("Тест завершен успешно. Всего проверок: %1, неисправностей не обнаружено. Время: %2")
+                       .arg(reads).arg(timeStr));
+        }
+    } else {
+        if (_logger) {
+            _logger->error(QString("Тест завершен. Всего проверок: %1, ошибочных чтений: %2, неисправных адресов: %3. Время: %4")
+                     .arg(reads).arg(failedReads).arg(fails).arg(timeStr));
+        }
+    }
+
+    // Seeds make the run reproducible: re-inject the same faults with these seeds
+    std::vector<InjectedFault> faults = _mem ? _mem->faults() : std::vector<InjectedFault>();
+    if (!faults.empty() && _logger) {
+        QStringList seeds;
+        for (const auto& f : faults) seeds << QString::number(f.seed);
+        _logger->info(QString("Seed неисправностей: %1").arg(seeds.join(", ")));
+    }
+
+    emit testFinished(results);
+    emit testResultsUpdated(results);
+}
+
+void TestController::onAlgorithmChanged(int index) {
+    // Index parameter is part of Qt signal signature
+    Q_UNUSED(index);
+    if (_testInfoLabel && _algoCombo) {
+        const MarchAlgorithm* algo = MarchLibrary::find(_algoCombo->currentData().toString());
+        QString desc = algo ? DataFormatter::getAlgorithmDescription(*algo) : DataFormatter::getMarchNotationHelp();
+        _testInfoLabel->setText(QString("Алгоритм: %1\n\n%2").arg(_algoCombo->currentText()).arg(desc));
+        // The notation field is only used by the custom algorithm entry
+        if (_marchEdit) {
+            _marchEdit->setEnabled(algo == nullptr);
+        }
+    }
+}
+
+bool TestController::selectedAlgorithm(MarchAlgorithm& algo) {
+    const MarchAlgorithm* builtin = MarchLibrary::find(_algoCombo->currentData().toString());
+    if (builtin) {
+        algo = *builtin;
+        return true;
+    }
+
+    QString notation = _marchEdit ? _marchEdit->text() : QString();
+    QString error;
+    if (!MarchLibrary::compile(_algoCombo->currentText(), notation, DataBackground::Solid, algo, &error)) {
+        if (_logger) {
+            _logger->error(QString("Ошибка в March-нотации: %1").arg(error));
+        }
+        QMessageBox::warning(qobject_cast<QWidget*>(parent()), "Ошибка в March-нотации", error);
+        return false;
+    }
+    return true;
+}
+
+void TestController::pollProgress() {
+    if (!_worker) return;
+    TraceScope scope("progress poll", "gui");
+    const ProgressState& state = _worker->progressState();
+    if (_progress) {
+        _progress->setValue(state.percent());
+    }
+    ProgressSample sample;
+    quint64 version = 0;
+    if (state.latestSample(sample, &version) && version != _sampleVersion) {
+        _sampleVersion = version;
+        showSample(sample);
+    }
+}
+
+void TestController::showSample(const ProgressSample& sample) {
+    highlightCurrentAddress(sample.addr);
+    if (_expectedValueLabel) {
+        _expectedValueLabel->setText(QString("Ожидается: 0x%1").arg(sample.expected, 8, 16, QChar('0')).toUpper());
+    }
+    if (_readValueLabel) {
+        _readValueLabel->setText(QString("Прочитано: 0x%1").arg(sample.read, 8, 16, QChar('0')).toUpper());
+    }
+
+    // Update table highlighting using table manager
+    if (_tableManager) {
+        _tableManager->updateProgressHighlight(sample.addr, _lastHighlightedAddr);
+    }
+}
+
+void TestController::highlightCurrentAddress(size_t addr) {
+    if (_currentAddrLabel) {
+        _currentAddrLabel->setText(QString("Адрес: %1").arg(addr));
+    }
+    if (_tableManager) {
+        _tableManager->highlightAddress(addr);
+    }
+}
+
@@ -3,10 +3,13 @@
 
 #include <QObject>
 #include <QComboBox>
+#include <QLineEdit>
+#include <QSpinBox>
 #include <QPushButton>
 #include <QProgressBar>
 #include <QLabel>
-#include <QTime>
+#include <QElapsedTimer>
+#include <QTimer>
 #include <memory>
 #include <vector>
 #include "types.h"
@@ -15,6 +18,8 @@
 #include "logger.h"
 #include "dataformatter.h"
 #include "memorytablemanager.h"
+#include "testresultset.h"
+#include "tracer.h"
 
 class TestController : public QObject {
     Q_OBJECT
@@ -23,7 +28,12 @@ public:
                            MemoryModel* mem,
                            MemoryTableManager* tableManager,
                            QComboBox* algoCombo,
+                           QComboBox* modeCombo,
+                           QLineEdit* marchEdit,
+                           QSpinBox* threadSpin,
                            QPushButton* startBtn,
+                           QPushButton* pauseBtn,
+                           QPushButton* stopBtn,
                            QProgressBar* progress,
                            QLabel* testInfoLabel,
                            QLabel* currentAddrLabel,
@@ -42,30 +52,48 @@ public:
     
 public slots:
     void startTest();
-    void onTestFinished(const std::vector<TestResult>& results);
+    void togglePause();
+    void stopTest();
+    void onTestFinished(const TestResultsPtr& results);
     void onAlgorithmChanged(int index);
-    void updateProgressDetails(size_t addr, Word expected, Word read);
     
 signals:
     void testStarted();
-    void testFinished(const std::vector<TestResult>& results);
-    void testResultsUpdated(const std::vector<TestResult>& results);
+    void testFinished(const TestResultsPtr& results);
+    void testResultsUpdated(const TestResultsPtr& results);
     
+private slots:
+    void pollProgress();
+
 private:
+    void showSample(const ProgressSample& sample);
     void highlightCurrentAddress(size_t addr);
+    bool selectedAlgorithm(MarchAlgorithm& algo);
+    void updateRunButtons();
     
     TesterWorker* _worker;
     MemoryModel* _mem;
     MemoryTableManager* _tableManager;
     Logger* _logger;
     bool _testRunning;
-    QTime _testStartTime;
+    QElapsedTimer _testTimer;  // Monotonic, unaffected by clock changes
+    QElapsedTimer _pauseTimer;
+    int _pausedMsecs; // Time spent paused, excluded from the test time
     size_t _lastHighlightedAddr;
     int _lastTestTimeMsecs;
+    QTimer* _progressPoll; // Frame clock for reading the worker's progress state
+    quint64 _sampleVersion; // Last sample shown; unchanged samples are not repainted
+    // Receiving end of the worker's finished() flow in the trace
+    TraceChannel _finishedTrace;
     
     // UI elements (not owned)
     QComboBox* _algoCombo;
+    QComboBox* _modeCombo;
+    QLineEdit* _marchEdit;
+    QSpinBox* _threadSpin;
     QPushButton* _startBtn;
+    QPushButton* _pauseBtn;
+    QPushButton* _stopBtn;
     QProgressBar* _progress;
     QLabel* _testInfoLabel;
     QLabel* _currentAddrLabel;
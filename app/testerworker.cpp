@@ -16,6 +16,7 @@ TesterWorker::TesterWorker(MemoryModel* mem, QObject* parent)
 void TesterWorker::initialize() {
     qDebug() << "TesterWorker::initialize: start";
     // Start thread first
+    _thread.setObjectName("Тестер"); // Thread label in traces
     _thread.start();
     qDebug() << "TesterWorker::initialize: thread started";
     
@@ -31,12 +32,12 @@ void TesterWorker::initialize() {
         qDebug() << "TesterWorker::initialize: creating MemoryTester in worker thread";
         if (!_tester && _mem) {
             _tester.reset(new MemoryTester(_mem));
+            _tester->setRunControl(&_control);
+            _tester->setProgressState(&_progress);
             qDebug() << "TesterWorker::initialize: MemoryTester created";
             
-            // Now that both objects are in the same thread, connect signals with DirectConnection
+            // Now that both objects are in the same thread, connect the signal with DirectConnection
             // for better performance
-            connect(_tester.get(), &MemoryTester::progress, this, &TesterWorker::progress, Qt::DirectConnection);
-            connect(_tester.get(), &MemoryTester::progressDetail, this, &TesterWorker::progressDetail, Qt::DirectConnection);
             connect(_tester.get(), &MemoryTester::finished, this, &TesterWorker::finished, Qt::DirectConnection);
             qDebug() << "TesterWorker::initialize: signals connected";
         } else {
@@ -53,25 +54,39 @@ TesterWorker::~TesterWorker() {
         disconnect(_tester.get(), nullptr, nullptr, nullptr);
     }
     
-    // Stop any running operations
+    // Stop any running test: it leaves at the next block boundary (also when paused)
+    _control.requestCancel();
     if (_thread.isRunning()) {
         // Request thread to quit
         _thread.quit();
         
-        // Wait for thread to finish, but with timeout to avoid hanging
         // Important: wait() must be called from a different thread than the one being waited on
-        if (!_thread.wait(5000)) {
-            // If thread doesn't finish in 5 seconds, terminate it
-            _thread.terminate();
-            _thread.wait();
-        }
+        _thread.wait();
     }
 }
 
-void TesterWorker::run(TestAlgorithm algo) {
+void TesterWorker::prepareRun() {
+    _control.reset();
+    // The GUI starts polling before run() is dequeued - do not show the previous run meanwhile
+    _progress.reset(0);
+}
+
+void TesterWorker::cancel() {
+    _control.requestCancel();
+}
+
+void TesterWorker::pause() {
+    _control.pause();
+}
+
+void TesterWorker::resume() {
+    _control.resume();
+}
+
+void TesterWorker::run(const MarchAlgorithm& algo, TestExecutionMode mode, int threads) {
     // This slot runs in the worker thread (because object was moved).
     // _tester is a member variable, so it lives as long as TesterWorker
     if (_tester) {
-        _tester->runTest(algo);
+        _tester->runTest(algo, mode, threads);
     }
 }
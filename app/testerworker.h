@@ -0,0 +1,45 @@
+#ifndef TESTERWORKER_H
+#define TESTERWORKER_H
+
+#include <QObject>
+#include <QThread>
+#include <memory>
+#include "types.h"
+#include "memorytester.h"
+#include "marchtest.h"
+#include "runcontrol.h"
+#include "progressstate.h"
+
+class TesterWorker : public QObject {
+    Q_OBJECT
+public:
+    explicit TesterWorker(MemoryModel* mem, QObject* parent = nullptr);
+    ~TesterWorker() override;
+    
+    // Initialize thread - must be called after object is fully constructed
+    void initialize();
+
+    // Run control - called from the GUI thread while run() blocks the worker thread
+    void prepareRun();   // Clears a previous cancel/pause before queuing run()
+    void cancel();       // The run stops at the next block and reports partial results
+    void pause();
+    void resume();
+    bool isPaused() const { return _control.isPaused(); }
+    // Polled by the GUI while a test runs; written by the test engine only
+    const ProgressState& progressState() const { return _progress; }
+
+public slots:
+    void run(const MarchAlgorithm& algo, TestExecutionMode mode, int threads);
+
+signals:
+    void finished(const TestResultsPtr& results);
+
+private:
+    QThread _thread;
+    MemoryModel* _mem;
+    RunControl _control;
+    ProgressState _progress;
+    std::unique_ptr<MemoryTester> _tester;
+};
+
+#endif // TESTERWORKER_H
\ No newline at end of file
@@ -185,9 +185,9 @@ QString ThemeManager::getStylesheet(Theme theme) {
             "QLineEdit:focus { border-color: %6; } "
             "QDoubleSpinBox { background-color: %3; color: %2; border: 2px solid %4; border-radius: 4px; padding: 3px; } "
             "QDoubleSpinBox:focus { border-color: %6; } "
-            "QTableWidget { background-color: %1; color: %2; border: 2px solid %4; gridline-color: %5; } "
-            "QTableWidget::item { border: none; } "
-            "QTableWidget::item:selected { background-color: %4; color: %1; } "
+            "QTableView { background-color: %1; color: %2; border: 2px solid %4; gridline-color: %5; } "
+            "QTableView::item { border: none; } "
+            "QTableView::item:selected { background-color: %4; color: %1; } "
             "QHeaderView::section { background-color: %3; color: %4; border: 1px solid %4; padding: 5px; font-weight: bold; } "
             "QTextEdit { background-color: #0a0a0a; color: %2; border: 2px solid %4; border-radius: 4px; } "
             "QProgressBar { background-color: %3; color: %2; border: 2px solid %4; border-radius: 4px; text-align: center; } "
@@ -239,9 +239,9 @@ QString ThemeManager::getStylesheet(Theme theme) {
             "QLineEdit:focus { border-color: %6; } "
             "QDoubleSpinBox { background-color: %3; color: %2; border: 2px solid %4; border-radius: 4px; padding: 3px; } "
             "QDoubleSpinBox:focus { border-color: %6; } "
-            "QTableWidget { background-color: %1; color: %2; border: 2px solid %4; gridline-color: %5; } "
-            "QTableWidget::item { border: none; } "
-            "QTableWidget::item:selected { background-color: %4; color: %1; } "
+            "QTableView { background-color: %1; color: %2; border: 2px solid %4; gridline-color: %5; } "
+            "QTableView::item { border: none; } "
+            "QTableView::item:selected { background-color: %4; color: %1; } "
             "QHeaderView::section { background-color: %3; color: %4; border: 1px solid %4; padding: 5px; font-weight: bold; } "
             "QTextEdit { background-color: %1; color: %2; border: 2px solid %4; border-radius: 4px; } "
             "QProgressBar { background-color: %3; color: #ffffff; border: 2px solid %4; border-radius: 4px; text-align: center; } "
@@ -293,9 +293,9 @@ QString ThemeManager::getStylesheet(Theme theme) {
             "QLineEdit:focus { border-color: %6; } "
             "QDoubleSpinBox { background-color: %3; color: %2; border: 2px solid %4; border-radius: 4px; padding: 3px; } "
             "QDoubleSpinBox:focus { border-color: %6; } "
-            "QTableWidget { background-color: %1; color: %2; border: 2px solid %4; gridline-color: %5; } "
-            "QTableWidget::item { border: none; } "
-            "QTableWidget::item:selected { background-color: %4; color: %1; } "
+            "QTableView { background-color: %1; color: %2; border: 2px solid %4; gridline-color: %5; } "
+            "QTableView::item { border: none; } "
+            "QTableView::item:selected { background-color: %4; color: %1; } "
             "QHeaderView::section { background-color: %3; color: %4; border: 1px solid %4; padding: 5px; font-weight: bold; } "
             "QTextEdit { background-color: #0f0f1e; color: %2; border: 2px solid %4; border-radius: 4px; } "
             "QProgressBar { background-color: %3; color: %2; border: 2px solid %4; border-radius: 4px; text-align: center; } "
@@ -347,9 +347,9 @@ QString ThemeManager::getStylesheet(Theme theme) {
             "QLineEdit:focus { border-color: %6; } "
             "QDoubleSpinBox { background-color: %3; color: %2; border: 2px solid %4; border-radius: 4px; padding: 3px; } "
             "QDoubleSpinBox:focus { border-color: %6; } "
-            "QTableWidget { background-color: %1; color: %2; border: 2px solid %4; gridline-color: %5; } "
-            "QTableWidget::item { border: none; } "
-            "QTableWidget::item:selected { background-color: %4; color: %1; } "
+            "QTableView { background-color: %1; color: %2; border: 2px solid %4; gridline-color: %5; } "
+            "QTableView::item { border: none; } "
+            "QTableView::item:selected { background-color: %4; color: %1; } "
             "QHeaderView::section { background-color: %3; color: %4; border: 1px solid %4; padding: 5px; font-weight: bold; } "
             "QTextEdit { background-color: %1; color: %2; border: 2px solid %4; border-radius: 4px; } "
             "QProgressBar { background-color: %3; color: #ffffff; border: 2px solid %4; border-radius: 4px; text-align: center; } "
@@ -0,0 +1,38 @@
+#-------------------------------------------------
+#
+# Benchmarks of the memory / fault / test hot paths
+# and of the memory table model. Results are JSON.
+#
+#-------------------------------------------------
+
+QT += core gui widgets
+
+CONFIG += c++11 console
+CONFIG -= app_bundle
+
+TARGET = RAM_clone_bench
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+# Simulation engine (static library, no widgets)
+include(../core/core.pri)
+
+# Table code is benchmarked straight from the GUI sources
+INCLUDEPATH += ../app
+DEPENDPATH += ../app
+
+SOURCES += \
+    main.cpp \
+    benchmarkrunner.cpp \
+    ../app/memorytablemanager.cpp \
+    ../app/memorytablemodel.cpp \
+    ../app/dirtyrangeset.cpp \
+    ../app/thememanager.cpp
+
+HEADERS += \
+    benchmarkrunner.h \
+    ../app/memorytablemanager.h \
+    ../app/memorytablemodel.h \
+    ../app/dirtyrangeset.h \
+    ../app/thememanager.h
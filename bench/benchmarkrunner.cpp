@@ -0,0 +1,73 @@
+#include "benchmarkrunner.h"
+#include <QElapsedTimer>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QTextStream>
+#include <algorithm>
+
+BenchmarkRunner::BenchmarkRunner()
+    : _minTimeMs(200), _repetitions(3) {}
+
+bool BenchmarkRunner::setFilter(const QString& pattern, QString* errorMessage) {
+    QRegularExpression filter(pattern);
+    if (!filter.isValid()) {
+        if (errorMessage) *errorMessage = filter.errorString();
+        return false;
+    }
+    _filter = filter;
+    return true;
+}
+
+bool BenchmarkRunner::enabled(const QString& name) const {
+    return _filter.pattern().isEmpty() || _filter.match(name).hasMatch();
+}
+
+void BenchmarkRunner::run(const QString& name, const QJsonObject& params, quint64 items,
+                          const std::function<void()>& body) {
+    if (!enabled(name)) return;
+
+    body(); // Warm-up: page faults, caches, lazily built tables
+
+    Result best = {name, params, 0, items, 0.0, 0.0};
+    for (int rep = 0; rep < _repetitions; ++rep) {
+        QElapsedTimer timer;
+        quint64 iterations = 0;
+        timer.start();
+        do {
+            body();
+            ++iterations;
+        } while (timer.elapsed() < _minTimeMs);
+        double ns = double(timer.nsecsElapsed()) / double(iterations * std::max<quint64>(items, 1));
+        if (best.iterations == 0 || ns < best.ns_per_item) {
+            best.iterations = iterations;
+            best.ns_per_item = ns;
+        }
+    }
+    best.items_per_second = best.ns_per_item > 0.0 ? 1e9 / best.ns_per_item : 0.0;
+    _results.push_back(best);
+
+    // Progress on stderr; stdout may carry the JSON report
+    QTextStream(stderr) << QString("%1 %2  %3 ns/item  %4 items/s\n")
+                               .arg(name, -36)
+                               .arg(QString::fromUtf8(QJsonDocument(params).toJson(QJsonDocument::Compact)), -32)
+                               .arg(best.ns_per_item, 10, 'f', 2)
+                               .arg(best.items_per_second, 12, 'g', 4);
+}
+
+QByteArray BenchmarkRunner::toJson(const QJsonObject& environment) const {
+    QJsonArray benchmarks;
+    for (const Result& r : _results) {
+        QJsonObject entry;
+        entry["name"] = r.name;
+        entry["params"] = r.params;
+        entry["iterations"] = double(r.iterations);
+        entry["items"] = double(r.items);
+        entry["ns_per_item"] = r.ns_per_item;
+        entry["items_per_second"] = r.items_per_second;
+        benchmarks.append(entry);
+    }
+    QJsonObject root;
+    root["environment"] = environment;
+    root["benchmarks"] = benchmarks;
+    return QJsonDocument(root).toJson(QJsonDocument::Indented);
+}
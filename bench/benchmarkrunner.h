@@ -0,0 +1,56 @@
+#ifndef BENCHMARKRUNNER_H
+#define BENCHMARKRUNNER_H
+
+#include <QJsonObject>
+#include <QRegularExpression>
+#include <QString>
+#include <functional>
+#include <vector>
+
+// Minimal benchmark harness: every case is repeated until it has run for at
+// least minTimeMs, the fastest of `repetitions` measurements is reported.
+// Results are collected and written as one JSON document for regression tracking.
+class BenchmarkRunner {
+public:
+    struct Result {
+        QString name;
+        QJsonObject params;
+        quint64 iterations;      // Calls of the body in the reported measurement
+        quint64 items;           // Items processed per call (words, cells, ops...)
+        double ns_per_item;
+        double items_per_second;
+    };
+
+    BenchmarkRunner();
+
+    // Regular expression over benchmark names; false (filter unchanged) for an invalid pattern
+    bool setFilter(const QString& pattern, QString* errorMessage = nullptr);
+    void setMinTimeMs(int ms) { _minTimeMs = ms; }
+    void setRepetitions(int repetitions) { _repetitions = repetitions; }
+    bool enabled(const QString& name) const;
+
+    // Measures body(); items is the amount of work done by one call
+    void run(const QString& name, const QJsonObject& params, quint64 items, const std::function<void()>& body);
+
+    const std::vector<Result>& results() const { return _results; }
+    QByteArray toJson(const QJsonObject& environment) const;
+
+private:
+    QRegularExpression _filter;
+    int _minTimeMs;
+    int _repetitions;
+    std::vector<Result> _results;
+};
+
+// Keeps the optimizer from discarding benchmark results
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(Q_CC_GNU)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+#endif // BENCHMARKRUNNER_H
@@ -0,0 +1,289 @@
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QDateTime>
+#include <QFile>
+#include <QSysInfo>
+#include <QTableView>
+#include <QTextStream>
+#include <algorithm>
+#include <vector>
+#include "benchmarkrunner.h"
+#include "types.h"
+#include "constants.h"
+#include "memorymodel.h"
+#include "faultinjector.h"
+#include "comparekernel.h"
+#include "memorytester.h"
+#include "marchtest.h"
+#include "parallelexecutor.h"
+#include "dataformatter.h"
+#include "memorytablemanager.h"
+#include "memorytablemodel.h"
+
+namespace {
+
+const size_t ACCESS_WORDS = 64 * 1024; // Words touched per call in the access micro-benchmarks
+
+InjectedFault makeFault(FaultModel model, size_t addr, size_t len, double probability) {
+    InjectedFault f;
+    f.model = model;
+    f.addr = addr;
+    f.len = len;
+    f.flip_probability = probability;
+    f.seed = 42;
+    return f;
+}
+
+struct FaultCase {
+    const char* name;
+    FaultModel model;
+    double probability;
+};
+
+const FaultCase FAULT_CASES[] = {
+    {"sa0", FaultModel::StuckAt0, 1.0},
+    {"sa1", FaultModel::StuckAt1, 1.0},
+    {"sa1-p0.5", FaultModel::StuckAt1, 0.5},
+    {"bitflip-p0.001", FaultModel::BitFlip, 0.001},
+    {"bitflip-p0.05", FaultModel::BitFlip, 0.05},
+    {"open-p0.5", FaultModel::OpenRead, 0.5},
+    {"drf", FaultModel::Retention, 1.0},
+};
+
+void benchMemoryAccess(BenchmarkRunner& runner) {
+    const size_t n = 1 << 20;
+    const char* const setups[] = {"none", "bitflip-p0.01", "cfin-1k", "afremap-1k", "anpsf-1k"};
+    for (const char* setup : setups) {
+        MemoryModel mem(n);
+        const QString faults = setup;
+        if (faults == "bitflip-p0.01") mem.injectFault(makeFault(FaultModel::BitFlip, 0, n, 0.01));
+        if (faults == "cfin-1k") {
+            // 2K of the accessed words take the coupling write path, the rest stay on the fast path
+            InjectedFault coupling = makeFault(FaultModel::CouplingInversion, 0, 1024, 1.0);
+            coupling.aggressor_addr = 1024;
+            mem.injectFault(coupling);
+        }
+        if (faults == "afremap-1k") {
+            // 1K remapped addresses go through the decoder table on reads and writes
+            InjectedFault remap = makeFault(FaultModel::AddressRemap, 0, 1024, 1.0);
+            remap.target_addr = 1024;
+            mem.injectFault(remap);
+        }
+        if (faults == "anpsf-1k") {
+            // 1K base cells and their 8-neighborhoods (rows of 1K words) take the write path
+            mem.setTopology(1024, AddressScramble::None);
+            InjectedFault npsf = makeFault(FaultModel::NeighborhoodActive, 2048, 1024, 1.0);
+            npsf.neighborhood = 8;
+            mem.injectFault(npsf);
+        }
+        QJsonObject params;
+        params["words"] = double(n);
+        params["faults"] = faults;
+
+        runner.run("memory/read", params, ACCESS_WORDS, [&mem]() {
+            Word sum = 0;
+            for (size_t addr = 0; addr < ACCESS_WORDS; ++addr) sum += mem.read(addr);
+            doNotOptimize(sum);
+        });
+        runner.run("memory/write", params, ACCESS_WORDS, [&mem]() {
+            for (size_t addr = 0; addr < ACCESS_WORDS; ++addr) mem.write(addr, Word(addr));
+        });
+        std::vector<Word> buffer(ACCESS_WORDS);
+        runner.run("memory/readRange", params, ACCESS_WORDS, [&mem, &buffer]() {
+            mem.readRange(0, buffer.data(), ACCESS_WORDS);
+            doNotOptimize(buffer[0]);
+        });
+        runner.run("memory/fillPattern", params, ACCESS_WORDS, [&mem]() {
+            mem.fillPattern(0, ACCESS_WORDS, [](size_t addr) { return Word(addr); });
+        });
+    }
+}
+
+void benchFaultInjector(BenchmarkRunner& runner) {
+    for (const FaultCase& c : FAULT_CASES) {
+        FaultInjector injector;
+        injector.injectFault(makeFault(c.model, 0, ACCESS_WORDS, c.probability));
+        QJsonObject params;
+        params["model"] = c.name;
+        params["words"] = double(ACCESS_WORDS);
+
+        runner.run("fault/applyFault", params, ACCESS_WORDS, [&injector]() {
+            Word sum = 0;
+            for (size_t addr = 0; addr < ACCESS_WORDS; ++addr) sum += injector.applyFault(addr, 0x5A5A5A5Au);
+            doNotOptimize(sum);
+        });
+        std::vector<Word> words(ACCESS_WORDS, 0x5A5A5A5Au);
+        quint32 pass = 0;
+        runner.run("fault/applyFaultRange", params, ACCESS_WORDS, [&injector, &words, &pass]() {
+            injector.applyFaultRange(0, words.data(), ACCESS_WORDS, ++pass);
+            doNotOptimize(words[0]);
+        });
+    }
+}
+
+void benchCompareKernel(BenchmarkRunner& runner) {
+    // Large enough to stream from memory rather than from the cache
+    const size_t words = 16 << 20;
+    std::vector<Word> data(words);
+    const CompareKernel::Pattern pattern = CompareKernel::pattern([](size_t a) { return Word(1u << (a % BITS_PER_WORD)); });
+    for (size_t a = 0; a < words; ++a) data[a] = pattern.words[a % CompareKernel::PERIOD];
+    for (size_t a = 0; a < words; a += 4099) data[a] ^= 1u; // Sparse mismatches, as in a faulty run
+    std::vector<quint64> mismatches(CompareKernel::maskWords(words));
+
+    const CompareKernel::Isa selected = CompareKernel::isa();
+    const CompareKernel::Isa variants[] = {CompareKernel::Isa::Scalar, CompareKernel::Isa::Sse2,
+                                           CompareKernel::Isa::Avx2, CompareKernel::Isa::Avx512};
+    for (CompareKernel::Isa isa : variants) {
+        if (!CompareKernel::setIsa(isa)) continue;
+        QJsonObject params;
+        params["isa"] = CompareKernel::isaName(isa);
+        params["words"] = double(words);
+        runner.run("verify/compare", params, words, [&data, &pattern, &mismatches, words]() {
+            size_t failed = CompareKernel::compare(data.data(), words, 0, pattern, mismatches.data());
+            doNotOptimize(failed);
+        });
+    }
+    CompareKernel::setIsa(selected);
+}
+
+void benchAlgorithms(BenchmarkRunner& runner, const std::vector<size_t>& sizes, const std::vector<int>& threadCounts) {
+    for (size_t n : sizes) {
+        MemoryModel mem(n);
+        mem.injectFault(makeFault(FaultModel::BitFlip, n / 4, n / 2, 0.001));
+        MemoryTester tester(&mem);
+        for (const MarchAlgorithm& algo : MarchLibrary::algorithms()) {
+            for (int threads : threadCounts) {
+                QJsonObject params;
+                params["words"] = double(n);
+                params["threads"] = threads;
+                // One item is one memory operation (n * complexity per run)
+                runner.run(QString("march/%1").arg(algo.id), params, quint64(n) * algo.opsPerWord(),
+                           [&tester, &algo, threads]() {
+                    tester.runTest(algo, TestExecutionMode::Turbo, threads);
+                });
+            }
+        }
+    }
+}
+
+void benchFormatter(BenchmarkRunner& runner) {
+    const int values = 4096;
+    runner.run("format/binary", QJsonObject(), values, []() {
+        for (int i = 0; i < values; ++i) {
+            QString text = DataFormatter::formatBinary(Word(i) * 2654435761u);
+            doNotOptimize(text);
+        }
+    });
+}
+
+void benchTable(BenchmarkRunner& runner, size_t n) {
+    MemoryModel mem(n);
+    mem.injectFault(makeFault(FaultModel::StuckAt1, n / 2, 1024, 1.0));
+    QTableView view;
+    view.resize(900, 700);
+    MemoryTableManager manager(&view, &mem);
+    MemoryTableModel* model = qobject_cast<MemoryTableModel*>(view.model());
+    QJsonObject params;
+    params["words"] = double(n);
+
+    // Whole-array refresh request as sent after a fault injection or a test run
+    runner.run("table/refreshTable", params, 1, [&manager, n]() {
+        manager.refreshTable(0, n);
+        manager.flushPendingRefresh();
+    });
+    // Burst of single-word writes coalesced into one frame
+    runner.run("table/refreshTableBurst", params, 1024, [&manager]() {
+        for (size_t addr = 0; addr < 1024; ++addr) manager.refreshTable(addr, addr + 1);
+        manager.flushPendingRefresh();
+    });
+
+    // What a repaint of one screen costs: every role of every visible cell
+    const int rows = 40;
+    const int roles[] = {Qt::DisplayRole, Qt::TextAlignmentRole, Qt::FontRole, Qt::BackgroundRole,
+                         Qt::ForegroundRole, MemoryTableModel::FailedRole};
+    runner.run("table/data", params, quint64(rows) * MemoryTableModel::ColumnCount, [model, rows, &roles]() {
+        for (int row = 0; row < rows; ++row) {
+            for (int column = 0; column < MemoryTableModel::ColumnCount; ++column) {
+                QModelIndex index = model->index(row, column);
+                for (int role : roles) {
+                    QVariant value = model->data(index, role);
+                    doNotOptimize(value);
+                }
+            }
+        }
+    });
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    // The table benchmarks need a widget but no display
+    if (qgetenv("QT_QPA_PLATFORM").isEmpty()) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication app(argc, argv);
+    QCoreApplication::setApplicationName("RAM_clone_bench");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Цифровой двойник ОЗУ — бенчмарки модели памяти, неисправностей и тестов");
+    parser.addHelpOption();
+    QCommandLineOption outputOption(QStringList() << "o" << "output", "Файл JSON с результатами (по умолчанию stdout).", "file");
+    QCommandLineOption filterOption("filter", "Регулярное выражение по именам бенчмарков.", "regex");
+    QCommandLineOption minTimeOption("min-time", "Минимальное время одного замера, мс.", "ms", "200");
+    QCommandLineOption quickOption("quick", "Уменьшенные размеры массивов (быстрая проверка).");
+    parser.addOption(outputOption);
+    parser.addOption(filterOption);
+    parser.addOption(minTimeOption);
+    parser.addOption(quickOption);
+    parser.process(app);
+
+    BenchmarkRunner runner;
+    QString filterError;
+    if (!runner.setFilter(parser.value(filterOption), &filterError)) {
+        QTextStream(stderr) << "Ошибка: неверное регулярное выражение --filter: " << filterError << "\n";
+        return 1;
+    }
+    runner.setMinTimeMs(qMax(1, parser.value(minTimeOption).toInt()));
+
+    const bool quick = parser.isSet(quickOption);
+    std::vector<size_t> sizes = quick ? std::vector<size_t>{64 * 1024, 1 << 20}
+                                      : std::vector<size_t>{1 << 20, 16 << 20};
+    std::vector<int> threadCounts = {1};
+    int ideal = std::min(ParallelExecutor::defaultThreadCount(), MAX_TEST_THREADS);
+    if (ideal > 1) threadCounts.push_back(ideal);
+
+    benchMemoryAccess(runner);
+    benchFaultInjector(runner);
+    benchCompareKernel(runner);
+    benchAlgorithms(runner, sizes, threadCounts);
+    benchFormatter(runner);
+    benchTable(runner, quick ? size_t(1 << 20) : size_t(16 << 20));
+
+    QJsonObject environment;
+    environment["timestamp"] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+    environment["qt_version"] = QString(qVersion());
+    environment["cpu_architecture"] = QSysInfo::currentCpuArchitecture();
+    environment["os"] = QSysInfo::prettyProductName();
+    environment["ideal_threads"] = ideal;
+    environment["compare_isa"] = CompareKernel::isaName(CompareKernel::isa());
+    environment["quick"] = quick;
+#ifdef QT_DEBUG
+    environment["build"] = "debug";
+#else
+    environment["build"] = "release";
+#endif
+
+    QByteArray report = runner.toJson(environment);
+    if (parser.isSet(outputOption)) {
+        QFile file(parser.value(outputOption));
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate) || file.write(report) != report.size()) {
+            QTextStream(stderr) << "Ошибка: не удалось записать " << file.fileName() << "\n";
+            return 1;
+        }
+    } else {
+        QFile out;
+        out.open(stdout, QIODevice::WriteOnly);
+        out.write(report);
+    }
+    return 0;
+}
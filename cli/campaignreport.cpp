@@ -0,0 +1,152 @@
+#include "campaignreport.h"
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QStringList>
+
+namespace {
+
+// JSON numbers are doubles; 64-bit values that may exceed 2^53 are written as strings
+QJsonValue uint64Value(quint64 value) {
+    return QString::number(value);
+}
+
+QJsonObject faultToJson(const InjectedFault& f) {
+    QJsonObject fault;
+    fault["model"] = CampaignRunner::faultModelKey(f.model);
+    fault["addr"] = double(f.addr);
+    fault["len"] = double(f.len);
+    fault["probability"] = f.flip_probability;
+    fault["seed"] = uint64Value(f.seed);
+    if (isCouplingFault(f.model)) {
+        fault["aggressor"] = double(f.aggressor_addr);
+        fault["trigger"] = double(f.trigger_value);
+        fault["forced"] = double(f.forced_value);
+    }
+    if (f.model == FaultModel::Retention) {
+        fault["retention_ticks"] = double(f.retention_ticks);
+        fault["decayed"] = double(f.forced_value);
+    }
+    if (f.model == FaultModel::AddressNoCell) {
+        fault["value"] = double(f.forced_value);
+    } else if (isDecoderFault(f.model)) {
+        fault["target"] = double(f.target_addr);
+    }
+    if (isNeighborhoodFault(f.model)) {
+        fault["neighborhood"] = f.neighborhood;
+        fault["pattern"] = double(f.trigger_value);
+        if (f.model == FaultModel::NeighborhoodStatic) fault["forced"] = double(f.forced_value);
+    }
+    return fault;
+}
+
+QString csvField(const QString& text) {
+    if (!text.contains(',') && !text.contains('"') && !text.contains('\n')) return text;
+    QString quoted = text;
+    quoted.replace("\"", "\"\"");
+    return QString("\"%1\"").arg(quoted);
+}
+
+} // namespace
+
+QByteArray CampaignReport::toJson(const CampaignConfig& config, const std::vector<CampaignRun>& runs, int maxFailures) {
+    QJsonArray faults;
+    for (const InjectedFault& f : config.faults) faults.append(faultToJson(f));
+
+    QJsonArray results;
+    for (const CampaignRun& run : runs) {
+        const TestResultSet& r = *run.results;
+        const TestStatistics& stats = run.statistics;
+        QJsonObject entry;
+        entry["algorithm"] = run.algorithm.id;
+        entry["name"] = run.algorithm.name;
+        entry["notation"] = run.algorithm.notation;
+        entry["ops_per_word"] = double(run.algorithm.opsPerWord());
+        entry["completed"] = !r.cancelled();
+        entry["reads"] = uint64Value(stats.reads);
+        entry["tested_addresses"] = double(stats.tested_addresses);
+        entry["coverage_percent"] = stats.coveragePercent();
+        entry["failed_addresses"] = double(stats.failed_addresses);
+        entry["failed_reads"] = double(stats.failed_reads);
+        entry["fault_addresses"] = double(stats.fault_addresses);
+        entry["detected_fault_addresses"] = double(stats.detected_fault_addresses);
+        entry["detection_percent"] = stats.detectionPercent();
+        entry["detected"] = stats.failed_addresses > 0;
+        entry["elapsed_ms"] = double(stats.elapsed_ms);
+        entry["reads_per_second"] = stats.readsPerSecond();
+
+        QJsonArray phases;
+        for (const PhaseMetrics& p : r.phases()) {
+            QJsonObject phase;
+            phase["element"] = p.notation;
+            phase["words"] = double(p.words);
+            phase["elapsed_ns"] = double(p.elapsed_ns);
+            phase["reads"] = double(p.reads);
+            phase["writes"] = double(p.writes);
+            phase["fault_applications"] = double(p.fault_applications);
+            phase["lock_waits"] = double(p.lock_waits);
+            phase["lock_wait_ns"] = double(p.lock_wait_ns);
+            phase["words_per_second"] = p.wordsPerSecond();
+            phase["ns_per_op"] = p.nsPerOperation();
+            phases.append(phase);
+        }
+        entry["phases"] = phases;
+
+        QJsonArray failures;
+        int limit = maxFailures < 0 ? int(r.failures().size()) : maxFailures;
+        for (const TestFailure& f : r.failures()) {
+            if (failures.size() >= limit) break;
+            QJsonObject failure;
+            failure["addr"] = double(f.addr);
+            failure["expected"] = double(f.expected);
+            failure["read"] = double(f.read);
+            failure["pass"] = double(f.pass);
+            failures.append(failure);
+        }
+        entry["failures"] = failures;
+        entry["failures_truncated"] = size_t(failures.size()) < r.failures().size();
+        results.append(entry);
+    }
+
+    QJsonObject root;
+    root["memory_words"] = double(config.memory_words);
+    root["threads"] = config.threads;
+    QJsonObject topology;
+    topology["columns"] = double(config.topology_columns);
+    topology["rows"] = double((config.memory_words + config.topology_columns - 1) / config.topology_columns);
+    topology["scramble"] = CampaignRunner::scrambleKey(config.scramble);
+    root["topology"] = topology;
+    root["faults"] = faults;
+    root["results"] = results;
+    return QJsonDocument(root).toJson(QJsonDocument::Indented);
+}
+
+QByteArray CampaignReport::toCsv(const CampaignConfig& config, const std::vector<CampaignRun>& runs) {
+    QStringList seeds;
+    for (const InjectedFault& f : config.faults) seeds << QString::number(f.seed);
+
+    QStringList lines;
+    lines << "algorithm,notation,memory_words,threads,faults,seeds,ops_per_word,reads,tested_addresses,"
+             "failed_addresses,failed_reads,fault_addresses,detected_fault_addresses,detected,elapsed_ms";
+    for (const CampaignRun& run : runs) {
+        const TestStatistics& stats = run.statistics;
+        QStringList row;
+        row << csvField(run.algorithm.id)
+            << csvField(run.algorithm.notation)
+            << QString::number(config.memory_words)
+            << QString::number(config.threads)
+            << QString::number(config.faults.size())
+            << csvField(seeds.join(";"))
+            << QString::number(run.algorithm.opsPerWord())
+            << QString::number(stats.reads)
+            << QString::number(stats.tested_addresses)
+            << QString::number(stats.failed_addresses)
+            << QString::number(stats.failed_reads)
+            << QString::number(stats.fault_addresses)
+            << QString::number(stats.detected_fault_addresses)
+            << (stats.failed_addresses > 0 ? "1" : "0")
+            << QString::number(stats.elapsed_ms);
+        lines << row.join(",");
+    }
+    return (lines.join("\n") + "\n").toUtf8();
+}
@@ -0,0 +1,18 @@
+#ifndef CAMPAIGNREPORT_H
+#define CAMPAIGNREPORT_H
+
+#include <QByteArray>
+#include <vector>
+#include "campaignrunner.h"
+
+// Machine-readable campaign output
+class CampaignReport {
+public:
+    // One JSON document: configuration, faults and one entry per algorithm,
+    // including up to maxFailures failing reads of each run
+    static QByteArray toJson(const CampaignConfig& config, const std::vector<CampaignRun>& runs, int maxFailures);
+    // One CSV row per algorithm (header included), failures are summarised only
+    static QByteArray toCsv(const CampaignConfig& config, const std::vector<CampaignRun>& runs);
+};
+
+#endif // CAMPAIGNREPORT_H
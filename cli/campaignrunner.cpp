@@ -0,0 +1,353 @@
+#include "campaignrunner.h"
+#include "memorymodel.h"
+#include "memorytester.h"
+#include "constants.h"
+#include "tracer.h"
+#include <QElapsedTimer>
+#include <QStringList>
+#include <algorithm>
+
+namespace {
+
+struct FaultModelKey {
+    const char* key;
+    FaultModel model;
+};
+
+const FaultModelKey FAULT_MODEL_KEYS[] = {
+    {"sa0", FaultModel::StuckAt0},
+    {"sa1", FaultModel::StuckAt1},
+    {"bitflip", FaultModel::BitFlip},
+    {"open", FaultModel::OpenRead},
+    {"cfin", FaultModel::CouplingInversion},
+    {"cfid", FaultModel::CouplingIdempotent},
+    {"cfst", FaultModel::CouplingState},
+    {"tfup", FaultModel::TransitionUp},
+    {"tfdown", FaultModel::TransitionDown},
+    {"drf", FaultModel::Retention},
+    {"afnone", FaultModel::AddressNoCell},
+    {"afremap", FaultModel::AddressRemap},
+    {"afmulti", FaultModel::AddressMulti},
+    {"anpsf", FaultModel::NeighborhoodActive},
+    {"pnpsf", FaultModel::NeighborhoodPassive},
+    {"snpsf", FaultModel::NeighborhoodStatic},
+};
+
+struct ScrambleKey {
+    const char* key;
+    AddressScramble scramble;
+};
+
+const ScrambleKey SCRAMBLE_KEYS[] = {
+    {"none", AddressScramble::None},
+    {"columns", AddressScramble::ColumnReverse},
+    {"rows", AddressScramble::RowTwist},
+};
+
+bool parseWordValue(const QString& text, Word& value) {
+    bool ok = false;
+    qulonglong parsed = text.trimmed().toULongLong(&ok, 0); // Decimal or 0x-prefixed hex
+    if (!ok || parsed > 0xFFFFFFFFull) return false;
+    value = Word(parsed);
+    return true;
+}
+
+// Coupling part of a spec: AGGR[:TRIGGER[:FORCED]] after MODEL:ADDR:LEN
+bool parseCoupling(const QString& spec, const QStringList& parts, InjectedFault& f, QString* errorMessage) {
+    const bool inversion = f.model == FaultModel::CouplingInversion;
+    const int minParts = inversion ? 4 : 6;
+    const int maxParts = inversion ? 5 : 6;
+    if (parts.size() < minParts || parts.size() > maxParts) {
+        if (errorMessage) {
+            *errorMessage = inversion ? QString("'%1': ожидается cfin:ADDR:LEN:AGGR[:TRIGGER]").arg(spec)
+                                      : QString("'%1': ожидается %2:ADDR:LEN:AGGR:TRIGGER:FORCED").arg(spec).arg(parts[0]);
+        }
+        return false;
+    }
+    bool ok = false;
+    f.aggressor_addr = size_t(parts[3].trimmed().toULongLong(&ok));
+    if (!ok) {
+        if (errorMessage) *errorMessage = QString("'%1': адрес агрессора должен быть целым числом").arg(spec);
+        return false;
+    }
+    if ((parts.size() >= 5 && !parseWordValue(parts[4], f.trigger_value)) ||
+        (parts.size() >= 6 && !parseWordValue(parts[5], f.forced_value))) {
+        if (errorMessage) *errorMessage = QString("'%1': значения связи - 32-битные числа (десятичные или 0x...)").arg(spec);
+        return false;
+    }
+    if (f.len > MAX_COUPLING_LENGTH) {
+        if (errorMessage) *errorMessage = QString("'%1': длина связи не больше %2").arg(spec).arg(MAX_COUPLING_LENGTH);
+        return false;
+    }
+    f.flip_probability = 1.0; // Coupling faults are deterministic
+    return true;
+}
+
+// Retention part of a spec: [:TICKS[:VALUE]] after drf:ADDR:LEN
+bool parseRetention(const QString& spec, const QStringList& parts, InjectedFault& f, QString* errorMessage) {
+    if (parts.size() > 5) {
+        if (errorMessage) *errorMessage = QString("'%1': ожидается drf:ADDR:LEN[:TICKS[:VALUE]]").arg(spec);
+        return false;
+    }
+    f.retention_ticks = DEFAULT_RETENTION_TICKS;
+    f.forced_value = 0;
+    if (parts.size() >= 4) {
+        bool ok = false;
+        f.retention_ticks = parts[3].trimmed().toULongLong(&ok);
+        if (!ok || f.retention_ticks == 0) {
+            if (errorMessage) *errorMessage = QString("'%1': время хранения - положительное число тактов").arg(spec);
+            return false;
+        }
+    }
+    if (parts.size() == 5 && !parseWordValue(parts[4], f.forced_value)) {
+        if (errorMessage) *errorMessage = QString("'%1': значение после распада - 32-битное число").arg(spec);
+        return false;
+    }
+    f.flip_probability = 1.0;
+    return true;
+}
+
+// Decoder part of a spec: afnone:ADDR:LEN[:VALUE] or afremap|afmulti:ADDR:LEN:TARGET
+bool parseDecoder(const QString& spec, const QStringList& parts, InjectedFault& f, QString* errorMessage) {
+    const bool noCell = f.model == FaultModel::AddressNoCell;
+    if ((noCell && parts.size() > 4) || (!noCell && parts.size() != 4)) {
+        if (errorMessage) {
+            *errorMessage = noCell ? QString("'%1': ожидается afnone:ADDR:LEN[:VALUE]").arg(spec)
+                                   : QString("'%1': ожидается %2:ADDR:LEN:TARGET").arg(spec).arg(parts[0]);
+        }
+        return false;
+    }
+    f.forced_value = 0;
+    if (noCell && parts.size() == 4 && !parseWordValue(parts[3], f.forced_value)) {
+        if (errorMessage) *errorMessage = QString("'%1': читаемое значение - 32-битное число").arg(spec);
+        return false;
+    }
+    if (!noCell) {
+        bool ok = false;
+        f.target_addr = size_t(parts[3].trimmed().toULongLong(&ok));
+        if (!ok) {
+            if (errorMessage) *errorMessage = QString("'%1': адрес ячейки должен быть целым числом").arg(spec);
+            return false;
+        }
+    }
+    if (f.len > MAX_DECODER_FAULT_LENGTH) {
+        if (errorMessage) *errorMessage = QString("'%1': длина неисправности дешифратора не больше %2").arg(spec).arg(MAX_DECODER_FAULT_LENGTH);
+        return false;
+    }
+    f.flip_probability = 1.0;
+    return true;
+}
+
+// Neighborhood part of a spec: [:HOOD[:PATTERN[:FORCED]]] after MODEL:ADDR:LEN, FORCED for snpsf only
+bool parseNeighborhood(const QString& spec, const QStringList& parts, InjectedFault& f, QString* errorMessage) {
+    const bool isStatic = f.model == FaultModel::NeighborhoodStatic;
+    if (parts.size() > (isStatic ? 6 : 5)) {
+        if (errorMessage) {
+            *errorMessage = isStatic ? QString("'%1': ожидается snpsf:ADDR:LEN[:HOOD[:PATTERN[:FORCED]]]").arg(spec)
+                                     : QString("'%1': ожидается %2:ADDR:LEN[:HOOD[:PATTERN]]").arg(spec).arg(parts[0]);
+        }
+        return false;
+    }
+    f.neighborhood = 4;
+    f.forced_value = 0;
+    if (parts.size() >= 4) {
+        f.neighborhood = parts[3].trimmed().toInt();
+        if (f.neighborhood != 4 && f.neighborhood != 8) {
+            if (errorMessage) *errorMessage = QString("'%1': соседство - 4 или 8 ячеек").arg(spec);
+            return false;
+        }
+    }
+    if ((parts.size() >= 5 && !parseWordValue(parts[4], f.trigger_value)) ||
+        (parts.size() >= 6 && !parseWordValue(parts[5], f.forced_value))) {
+        if (errorMessage) *errorMessage = QString("'%1': шаблон и значение - 32-битные числа (десятичные или 0x...)").arg(spec);
+        return false;
+    }
+    if (f.len > MAX_NPSF_BASE_CELLS) {
+        if (errorMessage) *errorMessage = QString("'%1': не больше %2 базовых ячеек").arg(spec).arg(MAX_NPSF_BASE_CELLS);
+        return false;
+    }
+    f.flip_probability = 1.0;
+    return true;
+}
+
+} // namespace
+
+CampaignRunner::CampaignRunner(const CampaignConfig& config)
+    : _config(config) {}
+
+bool CampaignRunner::parseScramble(const QString& key, AddressScramble& scramble) {
+    for (const ScrambleKey& entry : SCRAMBLE_KEYS) {
+        if (key.trimmed().toLower() == entry.key) {
+            scramble = entry.scramble;
+            return true;
+        }
+    }
+    return false;
+}
+
+QString CampaignRunner::scrambleKey(AddressScramble scramble) {
+    for (const ScrambleKey& entry : SCRAMBLE_KEYS) {
+        if (entry.scramble == scramble) return entry.key;
+    }
+    return "none";
+}
+
+QString CampaignRunner::faultModelKey(FaultModel model) {
+    for (const FaultModelKey& entry : FAULT_MODEL_KEYS) {
+        if (entry.model == model) return entry.key;
+    }
+    return "none";
+}
+
+bool CampaignRunner::parseFaultSpec(const QString& spec, quint64 defaultSeed, InjectedFault& fault,
+                                    QString* errorMessage) {
+    QStringList parts = spec.trimmed().split(':');
+    if (parts.size() < 3) {
+        if (errorMessage) *errorMessage = QString("'%1': ожидается MODEL:ADDR:LEN[:P[:SEED]]").arg(spec);
+        return false;
+    }
+
+    InjectedFault f;
+    QString key = parts[0].trimmed().toLower();
+    for (const FaultModelKey& entry : FAULT_MODEL_KEYS) {
+        if (key == entry.key) f.model = entry.model;
+    }
+    if (f.model == FaultModel::None) {
+        if (errorMessage) {
+            *errorMessage = QString("'%1': неизвестная модель '%2' (sa0, sa1, bitflip, open, cfin, cfid, cfst, "
+                                    "tfup, tfdown, drf, afnone, afremap, afmulti, anpsf, pnpsf, snpsf)")
+                            .arg(spec).arg(key);
+        }
+        return false;
+    }
+    if (!isCouplingFault(f.model) && f.model != FaultModel::NeighborhoodStatic && parts.size() > 5) {
+        if (errorMessage) *errorMessage = QString("'%1': ожидается MODEL:ADDR:LEN[:P[:SEED]]").arg(spec);
+        return false;
+    }
+
+    bool okAddr = false, okLen = false;
+    f.addr = size_t(parts[1].trimmed().toULongLong(&okAddr));
+    f.len = size_t(parts[2].trimmed().toULongLong(&okLen));
+    if (!okAddr || !okLen || f.len == 0) {
+        if (errorMessage) *errorMessage = QString("'%1': адрес и длина должны быть целыми числами, длина > 0").arg(spec);
+        return false;
+    }
+    if (actsOnWrite(f.model)) {
+        // Deterministic models: their own parameters instead of P and SEED
+        if (isCouplingFault(f.model) && !parseCoupling(spec, parts, f, errorMessage)) return false;
+        if (f.model == FaultModel::Retention && !parseRetention(spec, parts, f, errorMessage)) return false;
+        if (isDecoderFault(f.model) && !parseDecoder(spec, parts, f, errorMessage)) return false;
+        if (isNeighborhoodFault(f.model) && !parseNeighborhood(spec, parts, f, errorMessage)) return false;
+        if (isTransitionFault(f.model)) {
+            if (parts.size() > 3) {
+                if (errorMessage) *errorMessage = QString("'%1': ожидается %2:ADDR:LEN").arg(spec).arg(key);
+                return false;
+            }
+            f.flip_probability = 1.0;
+        }
+        f.seed = defaultSeed;
+        fault = f;
+        return true;
+    }
+
+    // Stuck-at faults are deterministic unless a probability is given
+    if (f.model != FaultModel::BitFlip) f.flip_probability = 1.0;
+    if (parts.size() >= 4) {
+        bool ok = false;
+        f.flip_probability = parts[3].trimmed().toDouble(&ok);
+        if (!ok || f.flip_probability < 0.0 || f.flip_probability > 1.0) {
+            if (errorMessage) *errorMessage = QString("'%1': вероятность должна быть в диапазоне 0-1").arg(spec);
+            return false;
+        }
+    }
+
+    f.seed = defaultSeed;
+    if (parts.size() == 5) {
+        bool ok = false;
+        f.seed = parts[4].trimmed().toULongLong(&ok);
+        if (!ok) {
+            if (errorMessage) *errorMessage = QString("'%1': seed должен быть целым неотрицательным числом").arg(spec);
+            return false;
+        }
+    }
+
+    fault = f;
+    return true;
+}
+
+bool CampaignRunner::run(std::vector<CampaignRun>& runs, QString* errorMessage) {
+    runs.clear();
+    const size_t n = _config.memory_words;
+    if (n == 0 || n > MAX_MEMORY_SIZE) {
+        if (errorMessage) *errorMessage = QString("Размер памяти должен быть в диапазоне 1-%1").arg(MAX_MEMORY_SIZE);
+        return false;
+    }
+    if (!MemoryTopology::isValidColumns(_config.topology_columns)) {
+        if (errorMessage) {
+            *errorMessage = QString("Число столбцов должно быть степенью двойки (1-%1)").arg(MAX_TOPOLOGY_COLUMNS);
+        }
+        return false;
+    }
+    for (const InjectedFault& f : _config.faults) {
+        if (f.addr >= n) {
+            if (errorMessage) *errorMessage = QString("Адрес неисправности %1 выходит за пределы памяти (0-%2)").arg(f.addr).arg(n - 1);
+            return false;
+        }
+        if (isCouplingFault(f.model) && f.aggressor_addr >= n) {
+            if (errorMessage) {
+                *errorMessage = QString("Адрес агрессора %1 выходит за пределы памяти (0-%2)").arg(f.aggressor_addr).arg(n - 1);
+            }
+            return false;
+        }
+        if (isDecoderFault(f.model) && f.model != FaultModel::AddressNoCell && f.target_addr >= n) {
+            if (errorMessage) {
+                *errorMessage = QString("Адрес ячейки дешифратора %1 выходит за пределы памяти (0-%2)").arg(f.target_addr).arg(n - 1);
+            }
+            return false;
+        }
+    }
+
+    for (const MarchAlgorithm& algo : _config.algorithms) {
+        TraceScope scope("campaign run", "cli");
+        if (scope.active()) scope.setDetail(algo.name);
+        MemoryModel mem(n);
+        mem.setTopology(_config.topology_columns, _config.scramble);
+        QString memoryError;
+        QObject::connect(&mem, &MemoryModel::errorOccurred, [&memoryError](const QString& message) {
+            if (memoryError.isEmpty()) memoryError = message;
+        });
+        for (const InjectedFault& f : _config.faults) {
+            InjectedFault clipped = f;
+            clipped.len = std::min(f.len, n - f.addr);
+            if (isCouplingFault(f.model)) clipped.len = std::min(clipped.len, n - f.aggressor_addr);
+            if (isDecoderFault(f.model) && f.model != FaultModel::AddressNoCell) {
+                clipped.len = std::min(clipped.len, n - f.target_addr);
+            }
+            mem.injectFault(clipped);
+        }
+
+        // No event loop here: finished() is delivered synchronously from runTest()
+        CampaignRun run;
+        run.algorithm = algo;
+        MemoryTester tester(&mem);
+        QObject::connect(&tester, &MemoryTester::finished, [&run](const TestResultsPtr& results) {
+            run.results = results;
+        });
+
+        QElapsedTimer timer;
+        timer.start();
+        tester.runTest(algo, TestExecutionMode::Turbo, _config.threads);
+        qint64 elapsedMs = timer.elapsed();
+
+        if (!memoryError.isEmpty() || !run.results) {
+            if (errorMessage) {
+                *errorMessage = QString("%1: %2").arg(algo.name)
+                                    .arg(memoryError.isEmpty() ? QString("тест не вернул результатов") : memoryError);
+            }
+            return false;
+        }
+        run.statistics = TestStatistics::compute(n, run.results.get(), mem.faultSnapshot().get(), elapsedMs);
+        runs.push_back(run);
+    }
+    return true;
+}
@@ -0,0 +1,54 @@
+#ifndef CAMPAIGNRUNNER_H
+#define CAMPAIGNRUNNER_H
+
+#include <QString>
+#include <vector>
+#include "types.h"
+#include "constants.h"
+#include "marchtest.h"
+#include "testresultset.h"
+#include "teststatistics.h"
+
+// One unattended test campaign: a memory configuration with a fixed fault set,
+// tested by every algorithm of the list in turn
+struct CampaignConfig {
+    size_t memory_words = 0;
+    size_t topology_columns = DEFAULT_TOPOLOGY_COLUMNS; // Physical layout for neighborhood faults
+    AddressScramble scramble = AddressScramble::None;
+    std::vector<InjectedFault> faults;
+    std::vector<MarchAlgorithm> algorithms;
+    int threads = 1;
+};
+
+struct CampaignRun {
+    MarchAlgorithm algorithm;
+    TestResultsPtr results;
+    TestStatistics statistics;
+};
+
+class CampaignRunner {
+public:
+    explicit CampaignRunner(const CampaignConfig& config);
+
+    // Runs the algorithms in order (turbo mode). Every algorithm gets a freshly
+    // zeroed memory with the same faults, so runs do not depend on each other.
+    bool run(std::vector<CampaignRun>& runs, QString* errorMessage = nullptr);
+
+    // Fault spec (see the --fault help text), values decimal or 0x...:
+    //   sa0|sa1|bitflip|open:ADDR:LEN[:P[:SEED]]   - without an explicit seed the fault gets defaultSeed
+    //   cfin:ADDR:LEN:AGGR[:TRIGGER], cfid|cfst:ADDR:LEN:AGGR:TRIGGER:FORCED
+    //   tfup|tfdown:ADDR:LEN, drf:ADDR:LEN[:TICKS[:VALUE]]
+    //   afnone:ADDR:LEN[:VALUE], afremap|afmulti:ADDR:LEN:TARGET
+    //   anpsf|pnpsf:ADDR:LEN[:HOOD[:PATTERN]], snpsf:ADDR:LEN[:HOOD[:PATTERN[:FORCED]]]
+    static bool parseFaultSpec(const QString& spec, quint64 defaultSeed, InjectedFault& fault,
+                               QString* errorMessage = nullptr);
+    static QString faultModelKey(FaultModel model);
+    // Scramble keys: none, columns (ColumnReverse), rows (RowTwist)
+    static bool parseScramble(const QString& key, AddressScramble& scramble);
+    static QString scrambleKey(AddressScramble scramble);
+
+private:
+    CampaignConfig _config;
+};
+
+#endif // CAMPAIGNRUNNER_H
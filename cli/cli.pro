@@ -0,0 +1,29 @@
+#-------------------------------------------------
+#
+# Headless batch runner: same memory model, fault
+# injector and march engine as the GUI, no widgets
+#
+#-------------------------------------------------
+
+QT += core
+QT -= gui
+
+CONFIG += c++11 console
+CONFIG -= app_bundle
+
+TARGET = RAM_clone_cli
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+# Simulation engine (static library, no widgets)
+include(../core/core.pri)
+
+SOURCES += \
+    main.cpp \
+    campaignrunner.cpp \
+    campaignreport.cpp
+
+HEADERS += \
+    campaignrunner.h \
+    campaignreport.h
@@ -0,0 +1,200 @@
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QFile>
+#include <QTextStream>
+#include <vector>
+#include "types.h"
+#include "constants.h"
+#include "dataformatter.h"
+#include "marchtest.h"
+#include "memorytopology.h"
+#include "parallelexecutor.h"
+#include "campaignrunner.h"
+#include "campaignreport.h"
+#include "tracer.h"
+
+// Exit codes for batch scripts
+enum ExitCode {
+    ExitOk = 0,
+    ExitUsage = 1,       // Invalid command line
+    ExitRunFailed = 2,   // The campaign could not be run
+    ExitDetected = 3     // --fail-on-detect and at least one algorithm found a fault
+};
+
+static int usageError(const QString& message) {
+    QTextStream(stderr) << "Ошибка: " << message << "\n";
+    return ExitUsage;
+}
+
+int main(int argc, char** argv) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("RAM_clone_cli");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Цифровой двойник ОЗУ — пакетный запуск тестов без графического интерфейса");
+    parser.addHelpOption();
+    QCommandLineOption memorySizeOption(QStringList() << "m" << "memory-size",
+        QString("Размер памяти в словах (1-%1), допускаются суффиксы K/M/G.").arg(MAX_MEMORY_SIZE),
+        "words", QString::number(DEFAULT_MEMORY_SIZE));
+    QCommandLineOption faultOption(QStringList() << "f" << "fault",
+        "Неисправность MODEL:ADDR:LEN[:P[:SEED]], MODEL = sa0|sa1|bitflip|open; неисправности связи "
+        "cfin:ADDR:LEN:AGGR[:TRIGGER], cfid|cfst:ADDR:LEN:AGGR:TRIGGER:FORCED; переходов tfup|tfdown:ADDR:LEN; "
+        "хранения drf:ADDR:LEN[:TICKS[:VALUE]]; дешифратора afnone:ADDR:LEN[:VALUE], "
+        "afremap|afmulti:ADDR:LEN:TARGET; соседства anpsf|pnpsf:ADDR:LEN[:HOOD[:PATTERN]], "
+        "snpsf:ADDR:LEN[:HOOD[:PATTERN[:FORCED]]]. Можно указывать несколько раз.",
+        "spec");
+    QCommandLineOption columnsOption("columns",
+        QString("Слов в физической строке (степень двойки, 1-%1); задаёт соседей для NPSF.").arg(MAX_TOPOLOGY_COLUMNS),
+        "count", QString::number(DEFAULT_TOPOLOGY_COLUMNS));
+    QCommandLineOption scrambleOption("scramble",
+        "Перемешивание адресов: none, columns (обратный порядок битов столбца) или rows (строки 2 и 3 каждой четвёрки).",
+        "mode", "none");
+    QCommandLineOption algorithmsOption(QStringList() << "a" << "algorithms",
+        "Алгоритмы через запятую (идентификаторы из --list-algorithms) или all.", "ids", "all");
+    QCommandLineOption marchOption("march",
+        "Пользовательский алгоритм в March-нотации. Можно указывать несколько раз.", "notation");
+    QCommandLineOption seedOption(QStringList() << "s" << "seed",
+        "Seed для неисправностей без явного seed; i-я неисправность получает seed+i.", "seed", "1");
+    QCommandLineOption threadsOption(QStringList() << "t" << "threads",
+        QString("Число рабочих потоков (1-%1).").arg(MAX_TEST_THREADS), "count",
+        QString::number(ParallelExecutor::defaultThreadCount()));
+    QCommandLineOption formatOption("format", "Формат результатов: json или csv.", "format", "json");
+    QCommandLineOption outputOption(QStringList() << "o" << "output", "Файл результатов (по умолчанию stdout).", "file");
+    QCommandLineOption maxFailuresOption("max-failures",
+        "Максимум ошибочных чтений на алгоритм в JSON (-1 — все).", "count", "100");
+    QCommandLineOption failOnDetectOption("fail-on-detect",
+        QString("Код возврата %1, если хотя бы один алгоритм обнаружил неисправность.").arg(int(ExitDetected)));
+    QCommandLineOption listOption("list-algorithms", "Вывести встроенные алгоритмы и выйти.");
+    QCommandLineOption traceOption("trace", "Записать временную шкалу выполнения (Chrome trace-event JSON).", "file");
+    parser.addOption(memorySizeOption);
+    parser.addOption(faultOption);
+    parser.addOption(columnsOption);
+    parser.addOption(scrambleOption);
+    parser.addOption(algorithmsOption);
+    parser.addOption(marchOption);
+    parser.addOption(seedOption);
+    parser.addOption(threadsOption);
+    parser.addOption(formatOption);
+    parser.addOption(outputOption);
+    parser.addOption(maxFailuresOption);
+    parser.addOption(failOnDetectOption);
+    parser.addOption(listOption);
+    parser.addOption(traceOption);
+    parser.process(app);
+
+    if (parser.isSet(listOption)) {
+        QTextStream out(stdout);
+        for (const MarchAlgorithm& algo : MarchLibrary::algorithms()) {
+            out << algo.id << "\t" << algo.name << "\t" << algo.notation << "\n";
+        }
+        return ExitOk;
+    }
+
+    CampaignConfig config;
+    if (!DataFormatter::parseWordCount(parser.value(memorySizeOption), config.memory_words)
+            || config.memory_words == 0 || config.memory_words > MAX_MEMORY_SIZE) {
+        return usageError(QString("неверный размер памяти '%1'").arg(parser.value(memorySizeOption)));
+    }
+
+    bool ok = false;
+    config.threads = parser.value(threadsOption).toInt(&ok);
+    if (!ok || config.threads < 1 || config.threads > MAX_TEST_THREADS) {
+        return usageError(QString("число потоков должно быть в диапазоне 1-%1").arg(MAX_TEST_THREADS));
+    }
+
+    config.topology_columns = parser.value(columnsOption).toULongLong(&ok);
+    if (!ok || !MemoryTopology::isValidColumns(config.topology_columns)) {
+        return usageError(QString("число столбцов должно быть степенью двойки (1-%1)").arg(MAX_TOPOLOGY_COLUMNS));
+    }
+    if (!CampaignRunner::parseScramble(parser.value(scrambleOption), config.scramble)) {
+        return usageError(QString("неизвестное перемешивание '%1'").arg(parser.value(scrambleOption)));
+    }
+
+    quint64 seed = parser.value(seedOption).toULongLong(&ok);
+    if (!ok) return usageError("seed должен быть целым неотрицательным числом");
+
+    int maxFailures = parser.value(maxFailuresOption).toInt(&ok);
+    if (!ok || maxFailures < -1) return usageError("--max-failures должно быть числом >= -1");
+
+    QString format = parser.value(formatOption).toLower();
+    if (format != "json" && format != "csv") return usageError(QString("неизвестный формат '%1'").arg(format));
+
+    const QStringList faultSpecs = parser.values(faultOption);
+    if (size_t(faultSpecs.size()) > MAX_FAULTS) {
+        return usageError(QString("не больше %1 неисправностей").arg(MAX_FAULTS));
+    }
+    for (int i = 0; i < faultSpecs.size(); ++i) {
+        InjectedFault fault;
+        QString error;
+        if (!CampaignRunner::parseFaultSpec(faultSpecs[i], seed + quint64(i), fault, &error)) {
+            return usageError(error);
+        }
+        config.faults.push_back(fault);
+    }
+
+    // Built-in algorithms first (in library order for "all"), then custom notations
+#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+    const QStringList ids = parser.value(algorithmsOption).split(',', Qt::SkipEmptyParts);
+#else
+    const QStringList ids = parser.value(algorithmsOption).split(',', QString::SkipEmptyParts);
+#endif
+    if (!parser.isSet(marchOption) || parser.isSet(algorithmsOption)) {
+        for (const QString& rawId : ids) {
+            QString id = rawId.trimmed();
+            if (id == "all") {
+                const std::vector<MarchAlgorithm>& all = MarchLibrary::algorithms();
+                config.algorithms.insert(config.algorithms.end(), all.begin(), all.end());
+                continue;
+            }
+            const MarchAlgorithm* algo = MarchLibrary::find(id);
+            if (!algo) return usageError(QString("неизвестный алгоритм '%1' (см. --list-algorithms)").arg(id));
+            config.algorithms.push_back(*algo);
+        }
+    }
+    const QStringList notations = parser.values(marchOption);
+    for (int i = 0; i < notations.size(); ++i) {
+        MarchAlgorithm algo;
+        QString error;
+        if (!MarchLibrary::compile(QString("Custom %1").arg(i + 1), notations[i], DataBackground::Solid, algo, &error)) {
+            return usageError(QString("March-нотация '%1': %2").arg(notations[i]).arg(error));
+        }
+        config.algorithms.push_back(algo);
+    }
+    if (config.algorithms.empty()) return usageError("не выбран ни один алгоритм");
+
+    std::vector<CampaignRun> runs;
+    QString error;
+    if (parser.isSet(traceOption)) {
+        Tracer::start(parser.value(traceOption));
+        Tracer::setThreadName("main");
+    }
+    bool completed = CampaignRunner(config).run(runs, &error);
+    QString traceError;
+    if (!Tracer::stop(&traceError)) {
+        QTextStream(stderr) << "Предупреждение: " << traceError << "\n";
+    }
+    if (!completed) {
+        QTextStream(stderr) << "Ошибка выполнения: " << error << "\n";
+        return ExitRunFailed;
+    }
+
+    QByteArray report = (format == "csv") ? CampaignReport::toCsv(config, runs)
+                                          : CampaignReport::toJson(config, runs, maxFailures);
+    if (parser.isSet(outputOption)) {
+        QFile file(parser.value(outputOption));
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate) || file.write(report) != report.size()) {
+            QTextStream(stderr) << "Ошибка: не удалось записать " << file.fileName() << "\n";
+            return ExitRunFailed;
+        }
+    } else {
+        QFile out;
+        out.open(stdout, QIODevice::WriteOnly);
+        out.write(report);
+    }
+
+    bool detected = false;
+    for (const CampaignRun& run : runs) {
+        if (run.statistics.failed_addresses > 0) detected = true;
+    }
+    return (detected && parser.isSet(failOnDetectOption)) ? ExitDetected : ExitOk;
+}
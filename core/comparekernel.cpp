@@ -0,0 +1,261 @@
+#include "comparekernel.h"
+#include <QtAlgorithms>
+#include <algorithm>
+#include <atomic>
+
+// Vector variants need GCC-style target attributes (MinGW, GCC, Clang) on x86
+#if defined(Q_CC_GNU) && (defined(__i386__) || defined(__x86_64__))
+#define RAM_COMPARE_X86 1
+#include <immintrin.h>
+// __builtin_cpu_supports("avx512f") needs GCC 5
+#if defined(__clang__) || __GNUC__ >= 5
+#define RAM_COMPARE_AVX512 1
+#endif
+#endif
+
+namespace {
+
+using CompareFn = size_t (*)(const Word*, size_t, size_t, const CompareKernel::Pattern&, quint64*);
+using MaskFn = void (*)(Word*, size_t, Word, Word);
+
+void maskTail(Word* data, size_t count, Word andMask, Word xorMask, size_t from) {
+    for (size_t i = from; i < count; ++i) data[i] = (data[i] & andMask) ^ xorMask;
+}
+
+void maskScalar(Word* data, size_t count, Word andMask, Word xorMask) {
+    maskTail(data, count, andMask, xorMask, 0);
+}
+
+// The vector loops below work on whole groups of 64 words (one mask word, a multiple
+// of the period, so the pattern phase is the same for every group); the rest is scalar.
+size_t compareTail(const Word* data, size_t count, size_t begin, const CompareKernel::Pattern& pattern,
+                   quint64* mismatches, size_t from) {
+    size_t failed = 0;
+    for (size_t group = from; group < count; group += 64) {
+        size_t end = std::min<size_t>(count, group + 64);
+        quint64 bits = 0;
+        for (size_t i = group; i < end; ++i) {
+            if (data[i] != pattern.words[(begin + i) % CompareKernel::PERIOD]) bits |= quint64(1) << (i - group);
+        }
+        mismatches[group / 64] = bits;
+        failed += size_t(qPopulationCount(bits));
+    }
+    return failed;
+}
+
+size_t compareScalar(const Word* data, size_t count, size_t begin, const CompareKernel::Pattern& pattern,
+                     quint64* mismatches) {
+    return compareTail(data, count, begin, pattern, mismatches, 0);
+}
+
+#ifdef RAM_COMPARE_X86
+
+__attribute__((target("sse2")))
+size_t compareSse2(const Word* data, size_t count, size_t begin, const CompareKernel::Pattern& pattern,
+                   quint64* mismatches) {
+    const size_t phase = begin % CompareKernel::PERIOD;
+    const size_t groups = count / 64;
+    size_t failed = 0;
+    for (size_t group = 0; group < groups; ++group) {
+        const Word* in = data + group * 64;
+        quint64 bits = 0;
+        for (size_t k = 0; k < 64; k += 4) {
+            __m128i actual = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + k));
+            __m128i expected = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern.words + (phase + k) % CompareKernel::PERIOD));
+            int equal = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(actual, expected)));
+            bits |= quint64(~equal & 0xF) << k;
+        }
+        mismatches[group] = bits;
+        failed += size_t(qPopulationCount(bits));
+    }
+    return failed + compareTail(data, count, begin, pattern, mismatches, groups * 64);
+}
+
+__attribute__((target("sse2")))
+void maskSse2(Word* data, size_t count, Word andMask, Word xorMask) {
+    const __m128i a = _mm_set1_epi32(int(andMask));
+    const __m128i x = _mm_set1_epi32(int(xorMask));
+    const size_t vectorEnd = count & ~size_t(3);
+    for (size_t i = 0; i < vectorEnd; i += 4) {
+        __m128i* p = reinterpret_cast<__m128i*>(data + i);
+        _mm_storeu_si128(p, _mm_xor_si128(_mm_and_si128(_mm_loadu_si128(p), a), x));
+    }
+    maskTail(data, count, andMask, xorMask, vectorEnd);
+}
+
+__attribute__((target("avx2")))
+size_t compareAvx2(const Word* data, size_t count, size_t begin, const CompareKernel::Pattern& pattern,
+                   quint64* mismatches) {
+    const size_t phase = begin % CompareKernel::PERIOD;
+    const size_t groups = count / 64;
+    size_t failed = 0;
+    for (size_t group = 0; group < groups; ++group) {
+        const Word* in = data + group * 64;
+        quint64 bits = 0;
+        for (size_t k = 0; k < 64; k += 8) {
+            __m256i actual = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + k));
+            __m256i expected = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pattern.words + (phase + k) % CompareKernel::PERIOD));
+            int equal = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(actual, expected)));
+            bits |= quint64(~equal & 0xFF) << k;
+        }
+        mismatches[group] = bits;
+        failed += size_t(qPopulationCount(bits));
+    }
+    return failed + compareTail(data, count, begin, pattern, mismatches, groups * 64);
+}
+
+__attribute__((target("avx2")))
+void maskAvx2(Word* data, size_t count, Word andMask, Word xorMask) {
+    const __m256i a = _mm256_set1_epi32(int(andMask));
+    const __m256i x = _mm256_set1_epi32(int(xorMask));
+    const size_t vectorEnd = count & ~size_t(7);
+    for (size_t i = 0; i < vectorEnd; i += 8) {
+        __m256i* p = reinterpret_cast<__m256i*>(data + i);
+        _mm256_storeu_si256(p, _mm256_xor_si256(_mm256_and_si256(_mm256_loadu_si256(p), a), x));
+    }
+    maskTail(data, count, andMask, xorMask, vectorEnd);
+}
+
+#ifdef RAM_COMPARE_AVX512
+__attribute__((target("avx512f")))
+size_t compareAvx512(const Word* data, size_t count, size_t begin, const CompareKernel::Pattern& pattern,
+                     quint64* mismatches) {
+    const size_t phase = begin % CompareKernel::PERIOD;
+    const size_t groups = count / 64;
+    size_t failed = 0;
+    for (size_t group = 0; group < groups; ++group) {
+        const Word* in = data + group * 64;
+        quint64 bits = 0;
+        for (size_t k = 0; k < 64; k += 16) {
+            __m512i actual = _mm512_loadu_si512(in + k);
+            __m512i expected = _mm512_loadu_si512(pattern.words + (phase + k) % CompareKernel::PERIOD);
+            bits |= quint64(_mm512_cmpneq_epi32_mask(actual, expected)) << k;
+        }
+        mismatches[group] = bits;
+        failed += size_t(qPopulationCount(bits));
+    }
+    return failed + compareTail(data, count, begin, pattern, mismatches, groups * 64);
+}
+
+__attribute__((target("avx512f")))
+void maskAvx512(Word* data, size_t count, Word andMask, Word xorMask) {
+    const __m512i a = _mm512_set1_epi32(int(andMask));
+    const __m512i x = _mm512_set1_epi32(int(xorMask));
+    const size_t vectorEnd = count & ~size_t(15);
+    for (size_t i = 0; i < vectorEnd; i += 16) {
+        _mm512_storeu_si512(data + i, _mm512_xor_si512(_mm512_and_si512(_mm512_loadu_si512(data + i), a), x));
+    }
+    maskTail(data, count, andMask, xorMask, vectorEnd);
+}
+#endif
+
+#endif // RAM_COMPARE_X86
+
+CompareFn variant(CompareKernel::Isa isa) {
+    switch (isa) {
+#ifdef RAM_COMPARE_X86
+    case CompareKernel::Isa::Sse2:
+        return compareSse2;
+    case CompareKernel::Isa::Avx2:
+        return compareAvx2;
+#ifdef RAM_COMPARE_AVX512
+    case CompareKernel::Isa::Avx512:
+        return compareAvx512;
+#endif
+#endif
+    default:
+        return compareScalar;
+    }
+}
+
+MaskFn maskVariant(CompareKernel::Isa isa) {
+    switch (isa) {
+#ifdef RAM_COMPARE_X86
+    case CompareKernel::Isa::Sse2:
+        return maskSse2;
+    case CompareKernel::Isa::Avx2:
+        return maskAvx2;
+#ifdef RAM_COMPARE_AVX512
+    case CompareKernel::Isa::Avx512:
+        return maskAvx512;
+#endif
+#endif
+    default:
+        return maskScalar;
+    }
+}
+
+CompareKernel::Isa bestIsa() {
+    const CompareKernel::Isa order[] = {CompareKernel::Isa::Avx512, CompareKernel::Isa::Avx2, CompareKernel::Isa::Sse2};
+    for (CompareKernel::Isa isa : order) {
+        if (CompareKernel::isSupported(isa)) return isa;
+    }
+    return CompareKernel::Isa::Scalar;
+}
+
+struct Dispatch {
+    Dispatch() : isa(bestIsa()), fn(variant(isa.load())), maskFn(maskVariant(isa.load())) {}
+    std::atomic<CompareKernel::Isa> isa;
+    std::atomic<CompareFn> fn;
+    std::atomic<MaskFn> maskFn;
+};
+
+Dispatch& dispatch() {
+    static Dispatch d; // Thread-safe initialisation on first use
+    return d;
+}
+
+} // namespace
+
+size_t CompareKernel::compare(const Word* data, size_t count, size_t begin, const Pattern& pattern, quint64* mismatches) {
+    return dispatch().fn.load(std::memory_order_relaxed)(data, count, begin, pattern, mismatches);
+}
+
+void CompareKernel::applyMask(Word* data, size_t count, Word andMask, Word xorMask) {
+    dispatch().maskFn.load(std::memory_order_relaxed)(data, count, andMask, xorMask);
+}
+
+CompareKernel::Isa CompareKernel::isa() {
+    return dispatch().isa.load();
+}
+
+bool CompareKernel::isSupported(Isa isa) {
+    switch (isa) {
+    case Isa::Scalar:
+        return true;
+#ifdef RAM_COMPARE_X86
+    case Isa::Sse2:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse2");
+    case Isa::Avx2:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+#ifdef RAM_COMPARE_AVX512
+    case Isa::Avx512:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx512f");
+#endif
+#endif
+    default:
+        return false;
+    }
+}
+
+bool CompareKernel::setIsa(Isa isa) {
+    if (!isSupported(isa)) return false;
+    Dispatch& d = dispatch();
+    d.fn.store(variant(isa));
+    d.maskFn.store(maskVariant(isa));
+    d.isa.store(isa);
+    return true;
+}
+
+const char* CompareKernel::isaName(Isa isa) {
+    switch (isa) {
+    case Isa::Scalar: return "scalar";
+    case Isa::Sse2: return "sse2";
+    case Isa::Avx2: return "avx2";
+    case Isa::Avx512: return "avx512";
+    }
+    return "unknown";
+}
@@ -0,0 +1,70 @@
+#ifndef COMPAREKERNEL_H
+#define COMPAREKERNEL_H
+
+#include <QtGlobal>
+#include <cstddef>
+#include "types.h"
+#include "constants.h"
+
+// Block verification: compares words read from memory with the expected data
+// background and records mismatches in a bitmask. Vector variants (SSE2, AVX2,
+// AVX-512) are selected at run time from the CPU features; failures are only
+// materialised by the caller for the set bits. The same dispatch serves the
+// compiled fault overlay of the read path (applyMask).
+class CompareKernel {
+public:
+    enum class Isa { Scalar, Sse2, Avx2, Avx512 };
+
+    // Data backgrounds repeat every PERIOD addresses: the expected word of address a
+    // is words[a % PERIOD]. The period is stored twice so that vector loads never wrap.
+    static constexpr size_t PERIOD = BITS_PER_WORD;
+    struct Pattern {
+        Word words[2 * PERIOD];
+    };
+
+    // Builds the pattern from expected(a) for a in [0, PERIOD)
+    template <typename Expected>
+    static Pattern pattern(Expected expected) {
+        Pattern p;
+        for (size_t j = 0; j < 2 * PERIOD; ++j) p.words[j] = expected(j % PERIOD);
+        return p;
+    }
+
+    // Bit i of mismatches (maskWords(count) words, all overwritten) is set when data[i]
+    // differs from the expected word of address begin + i. Returns the number of mismatches.
+    static size_t compare(const Word* data, size_t count, size_t begin, const Pattern& pattern, quint64* mismatches);
+    static size_t maskWords(size_t count) { return (count + 63) / 64; }
+
+    // data[i] = (data[i] & andMask) ^ xorMask for i < count (see FaultSet::Segment)
+    static void applyMask(Word* data, size_t count, Word andMask, Word xorMask);
+
+    // Calls f(i) for every set bit i < count, in increasing order
+    template <typename F>
+    static void forEachMismatch(const quint64* mismatches, size_t count, F f) {
+        for (size_t word = 0; word < maskWords(count); ++word) {
+            for (quint64 bits = mismatches[word]; bits; bits &= bits - 1) {
+                f(word * 64 + size_t(lowestSetBit(bits)));
+            }
+        }
+    }
+
+    // The variant in use: the best one the CPU supports unless overridden
+    static Isa isa();
+    static bool isSupported(Isa isa);
+    // Forces a variant (benchmarks); false if the CPU or the build does not support it
+    static bool setIsa(Isa isa);
+    static const char* isaName(Isa isa);
+
+private:
+    static int lowestSetBit(quint64 bits) {
+#if defined(Q_CC_GNU)
+        return __builtin_ctzll(bits);
+#else
+        int index = 0;
+        while (!(bits & 1u)) { bits >>= 1; ++index; }
+        return index;
+#endif
+    }
+};
+
+#endif // COMPAREKERNEL_H
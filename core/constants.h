@@ -0,0 +1,61 @@
+#ifndef CONSTANTS_H
+#define CONSTANTS_H
+
+#include <cstddef>
+
+// Задержка для визуализации прогресса тестирования (миллисекунды)
+constexpr int VISUALIZATION_DELAY_MS = 60;
+
+// Интервал обновления прогресса (каждые N адресов)
+constexpr int PROGRESS_UPDATE_INTERVAL = 10;
+
+// Turbo mode: words per bulk block and wake-up interval of the thread waiting for the pool
+constexpr size_t TURBO_BLOCK_WORDS = 64 * 1024;
+constexpr int PROGRESS_REPORT_INTERVAL_MS = 100;
+// Upper bound for the worker pool size (turbo partitions are TURBO_BLOCK_WORDS each)
+constexpr int MAX_TEST_THREADS = 256;
+
+// Memory configuration
+constexpr size_t DEFAULT_MEMORY_SIZE = 256;
+// 4Gi words (16 GiB) on 64-bit hosts; 32-bit builds are limited by their address space
+constexpr size_t MAX_MEMORY_SIZE = sizeof(size_t) >= 8 ? static_cast<size_t>(1ULL << 32)
+                                                      : static_cast<size_t>(1ULL << 28);
+
+// Storage layout: memory is allocated in 2 MiB chunks aligned for huge pages
+constexpr int MEMORY_CHUNK_SHIFT = 19;
+constexpr size_t MEMORY_CHUNK_WORDS = static_cast<size_t>(1) << MEMORY_CHUNK_SHIFT;
+constexpr size_t MEMORY_CHUNK_MASK = MEMORY_CHUNK_WORDS - 1;
+constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+constexpr size_t CACHE_LINE_SIZE = 64;
+// Retention faults: last-write stamps are allocated per 4K cells on first write
+constexpr int RETENTION_CHUNK_SHIFT = 12;
+constexpr size_t RETENTION_CHUNK_CELLS = static_cast<size_t>(1) << RETENTION_CHUNK_SHIFT;
+
+// Physical topology: rows of 2^k words (the column scramble table has one entry per column)
+constexpr size_t DEFAULT_TOPOLOGY_COLUMNS = 16;
+constexpr size_t MAX_TOPOLOGY_COLUMNS = static_cast<size_t>(1) << 16;
+
+// Word configuration
+constexpr int BITS_PER_WORD = 32;
+constexpr unsigned int INVALID_READ_MARKER = 0xFFFFFFFFu;
+
+// UI configuration
+constexpr int PROGRESS_MAX_PERCENT = 100;
+constexpr int PROGRESS_POLL_INTERVAL_MS = 33; // The GUI reads the shared progress state ~30 times per second
+constexpr int DEFAULT_FAULT_LENGTH = 100;
+// Faults per memory. Every segment lists all faults covering it, so nested faults need
+// up to 2 * MAX_FAULTS^2 fault references (32-bit indices in FaultSet), rebuilt per injection
+constexpr size_t MAX_FAULTS = 1024;
+constexpr size_t MAX_COUPLING_LENGTH = 64 * 1024; // Aggressor/victim pairs per coupling fault (each is indexed)
+// Address decoder faults: every remapped address is a node of the sparse remap table
+constexpr size_t MAX_DECODER_FAULT_LENGTH = 64 * 1024;
+// NPSF: a base cell is indexed together with up to 8 neighbors, so ~9 cells per base cell
+constexpr size_t MAX_NPSF_BASE_CELLS = 8 * 1024;
+constexpr unsigned long long DEFAULT_RETENTION_TICKS = 100; // Simulated ticks a retention-faulty cell holds its data
+constexpr unsigned long long DEFAULT_DELAY_TICKS = 1000;    // "Del" march element without an explicit length
+constexpr int TABLE_SCROLL_INTERVAL = 20;  // Scroll table every N addresses
+constexpr size_t TABLE_WINDOW_ROWS = 1 << 20; // Rows exposed to the view at once; the window follows navigation
+constexpr int TABLE_REFRESH_FRAME_MS = 16;     // dataChanged bursts within one frame are repainted together
+constexpr size_t TABLE_DIRTY_MAX_RANGES = 64;  // Pending ranges kept apart before they collapse into one span
+
+#endif // CONSTANTS_H
@@ -0,0 +1,15 @@
+# Links a project against the static engine library (core.pro).
+# Usage from a sibling directory: include(../core/core.pri)
+
+INCLUDEPATH += $$PWD
+DEPENDPATH += $$PWD
+
+CORE_BUILD_DIR = $$OUT_PWD/../core
+win32:CONFIG(release, debug|release): CORE_BUILD_DIR = $$CORE_BUILD_DIR/release
+else:win32:CONFIG(debug, debug|release): CORE_BUILD_DIR = $$CORE_BUILD_DIR/debug
+
+LIBS += -L$$CORE_BUILD_DIR -lramcore
+
+win32-g++: PRE_TARGETDEPS += $$CORE_BUILD_DIR/libramcore.a
+else:win32: PRE_TARGETDEPS += $$CORE_BUILD_DIR/ramcore.lib
+else: PRE_TARGETDEPS += $$CORE_BUILD_DIR/libramcore.a
@@ -0,0 +1,58 @@
+#-------------------------------------------------
+#
+# Simulation engine: memory model, fault injection,
+# march algorithms, results and statistics.
+# QtCore only - shared by the GUI and headless tools.
+#
+#-------------------------------------------------
+
+QT += core
+QT -= gui
+
+CONFIG += c++11 staticlib
+
+TARGET = ramcore
+TEMPLATE = lib
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+SOURCES += \
+    memorymodel.cpp \
+    memorystorage.cpp \
+    memorytester.cpp \
+    marchtest.cpp \
+    parallelexecutor.cpp \
+    runcontrol.cpp \
+    progressstate.cpp \
+    comparekernel.cpp \
+    tracer.cpp \
+    testresultset.cpp \
+    testmetrics.cpp \
+    teststatistics.cpp \
+    faultinjector.cpp \
+    faultset.cpp \
+    retentionstamps.cpp \
+    memorytopology.cpp \
+    dataformatter.cpp
+
+HEADERS += \
+    memorymodel.h \
+    memorystorage.h \
+    memorytester.h \
+    marchtest.h \
+    parallelexecutor.h \
+    runcontrol.h \
+    progressstate.h \
+    comparekernel.h \
+    tracer.h \
+    testresultset.h \
+    testmetrics.h \
+    teststatistics.h \
+    faultinjector.h \
+    faultset.h \
+    retentionstamps.h \
+    memorytopology.h \
+    counterrng.h \
+    dataformatter.h \
+    types.h \
+    constants.h
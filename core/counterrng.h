@@ -0,0 +1,79 @@
+#ifndef COUNTERRNG_H
+#define COUNTERRNG_H
+
+#include <cstdint>
+
+// Counter-based random number generator (Philox4x32-10, Salmon et al., SC'11).
+// The output is a pure function of (key, counter): a stream is identified by
+// (seed, address, pass), so fault outcomes are reproducible, do not depend on
+// which thread performs the read, and need no shared state between threads.
+class CounterRng {
+public:
+    CounterRng(uint64_t seed, uint64_t addr, uint32_t pass, uint32_t firstBlock = 0)
+        : _index(4) {
+        _key[0] = uint32_t(seed);
+        _key[1] = uint32_t(seed >> 32);
+        _ctr[0] = uint32_t(addr);
+        _ctr[1] = uint32_t(addr >> 32);
+        _ctr[2] = pass;
+        _ctr[3] = firstBlock; // Block index within the stream
+    }
+
+    // One Philox block (four 32-bit values) for an explicit counter
+    static void block(uint64_t seed, uint64_t counter, uint32_t pass, uint32_t blockIndex, uint32_t out[4]) {
+        const uint32_t key[2] = { uint32_t(seed), uint32_t(seed >> 32) };
+        const uint32_t ctr[4] = { uint32_t(counter), uint32_t(counter >> 32), pass, blockIndex };
+        philox(ctr, key, out);
+    }
+
+    // Maps 32 random bits to a uniform double in (0, 1]
+    static double toUniform(uint32_t bits) {
+        return (double(bits) + 1.0) * (1.0 / 4294967296.0);
+    }
+
+    // Next 32 random bits of the stream
+    uint32_t next() {
+        if (_index == 4) {
+            philox(_ctr, _key, _out);
+            ++_ctr[3];
+            _index = 0;
+        }
+        return _out[_index++];
+    }
+
+    // Uniform double in (0, 1] - never 0, so log() is always defined
+    double uniform() {
+        return toUniform(next());
+    }
+
+private:
+    static void mulhilo(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo) {
+        uint64_t p = uint64_t(a) * b;
+        hi = uint32_t(p >> 32);
+        lo = uint32_t(p);
+    }
+
+    static void philox(const uint32_t ctr[4], const uint32_t key[2], uint32_t out[4]) {
+        uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+        uint32_t k0 = key[0], k1 = key[1];
+        for (int round = 0; round < 10; ++round) {
+            uint32_t hi0, lo0, hi1, lo1;
+            mulhilo(0xD2511F53u, c0, hi0, lo0);
+            mulhilo(0xCD9E8D57u, c2, hi1, lo1);
+            c0 = hi1 ^ c1 ^ k0;
+            c1 = lo1;
+            c2 = hi0 ^ c3 ^ k1;
+            c3 = lo0;
+            k0 += 0x9E3779B9u;
+            k1 += 0xBB67AE85u;
+        }
+        out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+    }
+
+    uint32_t _key[2];
+    uint32_t _ctr[4];
+    uint32_t _out[4];
+    int _index;
+};
+
+#endif // COUNTERRNG_H
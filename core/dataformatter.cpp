@@ -0,0 +1,119 @@
+#include "dataformatter.h"
+
+QString DataFormatter::formatBinary(Word value) {
+    QString binary;
+    for (int i = 31; i >= 0; --i) {
+        binary += (value & (1u << i)) ? '1' : '0';
+        if (i % 4 == 0 && i > 0) binary += ' ';
+    }
+    return binary;
+}
+
+QString DataFormatter::formatHex(Word value) {
+    return "0x" + QString("%1").arg(value, 8, 16, QChar('0')).toUpper();
+}
+
+QString DataFormatter::getFaultModelName(FaultModel model) {
+    switch (model) {
+        case FaultModel::None: return "Нет";
+        case FaultModel::StuckAt0: return "Stuck-at-0";
+        case FaultModel::StuckAt1: return "Stuck-at-1";
+        case FaultModel::BitFlip: return "Bit-flip";
+        case FaultModel::OpenRead: return "Open (invalid read)";
+        case FaultModel::CouplingInversion: return "CFin";
+        case FaultModel::CouplingIdempotent: return "CFid";
+        case FaultModel::CouplingState: return "CFst";
+        case FaultModel::TransitionUp: return "TF↑ (0→1)";
+        case FaultModel::TransitionDown: return "TF↓ (1→0)";
+        case FaultModel::Retention: return "DRF (хранение)";
+        case FaultModel::AddressNoCell: return "AF (нет ячейки)";
+        case FaultModel::AddressRemap: return "AF (другая ячейка)";
+        case FaultModel::AddressMulti: return "AF (несколько ячеек)";
+        case FaultModel::NeighborhoodActive: return "ANPSF (активная)";
+        case FaultModel::NeighborhoodPassive: return "PNPSF (пассивная)";
+        case FaultModel::NeighborhoodStatic: return "SNPSF (статическая)";
+        default: return "Неизвестно";
+    }
+}
+
+QString DataFormatter::describeFault(const InjectedFault& f) {
+    QString text = QString("%1: адрес %2, длина %3").arg(getFaultModelName(f.model)).arg(f.addr).arg(f.len);
+    if (f.model == FaultModel::BitFlip) {
+        text += QString(", p(бит)=%1").arg(f.flip_probability, 0, 'f', 3);
+    } else if (isCouplingFault(f.model)) {
+        text += QString(", агрессор %1, триггер %2").arg(f.aggressor_addr).arg(formatHex(f.trigger_value));
+        if (f.model != FaultModel::CouplingInversion) text += QString(", жертва <- %1").arg(formatHex(f.forced_value));
+        return text; // Deterministic: no probability or seed
+    } else if (isTransitionFault(f.model)) {
+        return text;
+    } else if (f.model == FaultModel::AddressNoCell) {
+        return text + QString(", чтение %1").arg(formatHex(f.forced_value));
+    } else if (isDecoderFault(f.model)) {
+        return text + QString(", ячейка %1").arg(f.target_addr);
+    } else if (isNeighborhoodFault(f.model)) {
+        text += QString(", %1 соседей, шаблон %2").arg(f.neighborhood).arg(formatHex(f.trigger_value));
+        if (f.model == FaultModel::NeighborhoodStatic) text += QString(", ячейка <- %1").arg(formatHex(f.forced_value));
+        return text;
+    } else if (f.model == FaultModel::Retention) {
+        return text + QString(", хранение %1 тактов, затем %2").arg(f.retention_ticks).arg(formatHex(f.forced_value));
+    } else if (f.model != FaultModel::None) {
+        text += QString(", p=%1").arg(f.flip_probability, 0, 'f', 3);
+    }
+    if (f.model != FaultModel::None) {
+        text += QString(", seed=%1").arg(f.seed);
+    }
+    return text;
+}
+
+QString DataFormatter::getAlgorithmDescription(const MarchAlgorithm& algo) {
+    QString text = QString("%1\nСложность: %2n").arg(algo.notation).arg(algo.opsPerWord());
+    if (!algo.description.isEmpty()) {
+        text += "\n" + algo.description;
+    }
+    return text;
+}
+
+QString DataFormatter::getMarchNotationHelp() {
+    return "Пользовательский маршевый тест. Элементы разделяются ';', каждый элемент — порядок адресов "
+           "(⇑ или up — по возрастанию, ⇓ или down — по убыванию, ⇕ или any — любой) и список операций "
+           "r0, r1, w0, w1 в скобках. Элемент Del или Del(N) — задержка на N тактов модельного времени "
+           "(для неисправностей хранения). Пример: {⇕(w0); ⇑(r0,w1); ⇓(r1,w0); ⇕(r0)}";
+}
+
+QString DataFormatter::formatNanoseconds(qint64 ns) {
+    if (ns < 1000) return QString("%1 нс").arg(ns);
+    if (ns < 1000000) return QString("%1 мкс").arg(ns / 1e3, 0, 'f', ns < 10000 ? 2 : 0);
+    if (ns < 1000000000) return QString("%1 мс").arg(ns / 1e6, 0, 'f', ns < 100000000 ? 1 : 0);
+    return QString("%1 с").arg(ns / 1e9, 0, 'f', 2);
+}
+
+QString DataFormatter::formatScaled(double value) {
+    static const char* const prefixes[] = {"", " K", " M", " G", " T"};
+    int index = 0;
+    while (value >= 1000.0 && index < 4) {
+        value /= 1000.0;
+        ++index;
+    }
+    return QString("%1%2").arg(value, 0, 'f', index == 0 ? 0 : 2).arg(prefixes[index]);
+}
+
+bool DataFormatter::parseWordCount(const QString& text, size_t& words) {
+    QString t = text.trimmed().toUpper();
+    if (t.isEmpty()) return false;
+
+    int shift = 0;
+    QChar suffix = t.at(t.size() - 1);
+    if (suffix == 'K') shift = 10;
+    else if (suffix == 'M') shift = 20;
+    else if (suffix == 'G') shift = 30;
+    if (shift > 0) t.chop(1);
+
+    bool ok = false;
+    qulonglong value = t.toULongLong(&ok);
+    if (!ok) return false;
+    // Reject values that overflow size_t after scaling
+    if (shift > 0 && value > (static_cast<qulonglong>(static_cast<size_t>(-1)) >> shift)) return false;
+    if (value > static_cast<qulonglong>(static_cast<size_t>(-1))) return false;
+    words = static_cast<size_t>(value << shift);
+    return true;
+}
@@ -0,0 +1,39 @@
+#ifndef DATAFORMATTER_H
+#define DATAFORMATTER_H
+
+#include <QString>
+#include "types.h"
+#include "marchtest.h"
+
+class DataFormatter {
+public:
+    // Форматирование двоичного представления
+    static QString formatBinary(Word value);
+
+    // Шестнадцатеричное слово: 0x00FF00FF
+    static QString formatHex(Word value);
+    
+    // Получение имени модели неисправности
+    static QString getFaultModelName(FaultModel model);
+    
+    // Краткое описание внедренной неисправности (для списка неисправностей)
+    static QString describeFault(const InjectedFault& f);
+    
+    // Получение описания алгоритма тестирования
+    static QString getAlgorithmDescription(const MarchAlgorithm& algo);
+    
+    // Справка по March-нотации для пользовательских алгоритмов
+    static QString getMarchNotationHelp();
+    
+    // Длительность в наносекундах с подходящей единицей: "850 мкс", "12.3 мс", "1.25 с"
+    static QString formatNanoseconds(qint64 ns);
+
+    // Большие величины с десятичным префиксом: 7040000 → "7.04 M"
+    static QString formatScaled(double value);
+
+    // Разбор количества слов с необязательным суффиксом K/M/G (степени 1024), например "64M"
+    static bool parseWordCount(const QString& text, size_t& words);
+};
+
+#endif // DATAFORMATTER_H
+
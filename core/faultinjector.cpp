@@ -0,0 +1,448 @@
+#include "faultinjector.h"
+#include "constants.h"
+#include "counterrng.h"
+#include "comparekernel.h"
+#include <memory>
+#include <algorithm>
+#include <cmath>
+
+// Key of the random streams of a fault: its seed mixed (SplitMix64 finalizer) with the
+// model and start address, which do not change when other faults are removed or
+// reordered, so the logged seed of a fault reproduces it. Same-seed faults of another
+// model or range draw independent numbers; a fault duplicated with its seed repeats
+// the same draws (the CLI assigns seed + i and the GUI draws a random seed).
+static uint64_t faultStreamKey(const InjectedFault& f) {
+    uint64_t z = f.seed + (uint64_t(f.addr) * 32 + uint64_t(f.model) + 1) * 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// First random draw of every address. One Philox block serves four consecutive
+// addresses (counter = addr / 4, block 0, lane = addr % 4); most reads need only this
+// draw, so runs of words cost a quarter of a Philox call each. Further draws for an
+// address come from its own stream (counter = addr, blocks 1, 2, ...).
+class FirstDrawCache {
+public:
+    FirstDrawCache(uint64_t seed, quint32 pass) : _seed(seed), _pass(pass), _group(~uint64_t(0)) {}
+
+    uint32_t get(size_t addr) {
+        uint64_t group = uint64_t(addr) >> 2;
+        if (group != _group) {
+            CounterRng::block(_seed, group, _pass, 0, _lanes);
+            _group = group;
+        }
+        return _lanes[addr & 3];
+    }
+
+private:
+    uint64_t _seed;
+    quint32 _pass;
+    uint64_t _group;
+    uint32_t _lanes[4];
+};
+
+// Flips each of the count * BITS_PER_WORD bits independently with probability p.
+// Instead of one Bernoulli draw per bit, the gap to the next flipped bit is sampled
+// from a geometric distribution (inverse CDF: floor(log(u) / log(1 - p))), so the
+// RNG cost is proportional to the number of flips rather than to the number of bits.
+// The first draw is compared against P(no flip in the word) = (1 - p)^32 in integer
+// space, so clean words need neither log() nor a second Philox block.
+static void applyBitFlips(const InjectedFault& f, uint64_t key, size_t begin, Word* words, size_t count,
+                          quint32 pass) {
+    const double p = f.flip_probability;
+    if (p <= 0.0 || count == 0) return;
+    if (p >= 1.0) {
+        for (size_t i = 0; i < count; ++i) words[i] = ~words[i];
+        return;
+    }
+    const double logKeep = std::log1p(-p);
+    // u = (bits + 1) / 2^32 <= (1 - p)^32  <=>  bits < noFlipBound
+    const double noFlipBound = std::exp(logKeep * BITS_PER_WORD) * 4294967296.0;
+    FirstDrawCache firstDraw(key, pass);
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t bits = firstDraw.get(begin + i);
+        if (double(bits) + 1.0 <= noFlipBound) continue; // First gap reaches past the word
+        double bit = std::floor(std::log(CounterRng::toUniform(bits)) / logKeep);
+        CounterRng rng(key, begin + i, pass, 1);
+        while (bit < BITS_PER_WORD) {
+            words[i] ^= 1u << int(bit);
+            bit += 1.0 + std::floor(std::log(rng.uniform()) / logKeep);
+        }
+    }
+}
+
+// Per-address Bernoulli trial with probability p on the first draw of the address.
+// The caller keeps one cache per run, so consecutive words share their Philox blocks.
+static bool addressTriggered(const InjectedFault& f, FirstDrawCache& firstDraw, size_t addr) {
+    return CounterRng::toUniform(firstDraw.get(addr)) <= f.flip_probability;
+}
+
+// Value read from a triggered stuck-at or open cell
+static Word addressFaultValue(FaultModel model, Word storedValue) {
+    switch (model) {
+        case FaultModel::StuckAt0:
+            return 0u;
+        case FaultModel::StuckAt1:
+            return static_cast<Word>(~0u);
+        case FaultModel::OpenRead:
+            return INVALID_READ_MARKER; // marker for invalid read
+        default:
+            return storedValue;
+    }
+}
+
+// Per-thread reference to the last snapshot this thread has seen.
+// Readers compare its version with the injector's atomic version; only after a
+// change do they take the mutex once to pick up the new snapshot. Holding the
+// shared_ptr keeps the snapshot alive while the thread uses it.
+struct SnapshotCache {
+    quint64 version = 0;
+    std::shared_ptr<const FaultSnapshot> snapshot;
+};
+
+static QThreadStorage<SnapshotCache*> threadLocalSnapshotStorage;
+
+static SnapshotCache& getThreadLocalSnapshotCache() {
+    if (!threadLocalSnapshotStorage.hasLocalData()) {
+        threadLocalSnapshotStorage.setLocalData(new SnapshotCache());
+    }
+    return *threadLocalSnapshotStorage.localData();
+}
+
+// Versions are unique across all injectors, so a thread cache can never mistake
+// a snapshot of one injector for another's
+static std::atomic<quint64> nextSnapshotVersion(1);
+
+FaultInjector::FaultInjector()
+    : _topology(std::make_shared<MemoryTopology>()), _version(0), _pass(0), _ticks(0) {
+    QMutexLocker locker(&_mutex);
+    publish(std::vector<InjectedFault>());
+}
+
+// previousIndex[i] for a fault set whose first `count` faults are those of the current one
+static std::vector<size_t> keptFaults(size_t count) {
+    std::vector<size_t> previousIndex(count);
+    for (size_t i = 0; i < count; ++i) previousIndex[i] = i;
+    return previousIndex;
+}
+
+void FaultInjector::publish(const std::vector<InjectedFault>& faults, const std::vector<size_t>& previousIndex) {
+    std::shared_ptr<FaultSnapshot> snap(new FaultSnapshot());
+    snap->faults = FaultSet(faults, *_topology);
+    snap->topology = _topology;
+    // Surviving retention faults keep their write stamps; only new ones start at the current tick
+    snap->retention.build(faults, clock(), _snapshot ? &_snapshot->retention : nullptr, previousIndex);
+    snap->version = nextSnapshotVersion.fetch_add(1, std::memory_order_relaxed);
+    _snapshot = snap;
+    _version.store(snap->version, std::memory_order_release);
+}
+
+bool FaultInjector::injectFault(const InjectedFault& f) {
+    QMutexLocker locker(&_mutex);
+    std::vector<InjectedFault> faults = _snapshot->faults.faults();
+    if (faults.size() >= MAX_FAULTS) return false;
+    std::vector<size_t> previousIndex = keptFaults(faults.size());
+    faults.push_back(f);
+    previousIndex.push_back(RetentionStamps::NEW_FAULT);
+    publish(faults, previousIndex);
+    return true;
+}
+
+bool FaultInjector::removeFault(size_t index) {
+    QMutexLocker locker(&_mutex);
+    std::vector<InjectedFault> faults = _snapshot->faults.faults();
+    if (index >= faults.size()) return false;
+    std::vector<size_t> previousIndex = keptFaults(faults.size());
+    faults.erase(faults.begin() + index);
+    previousIndex.erase(previousIndex.begin() + index);
+    publish(faults, previousIndex);
+    return true;
+}
+
+std::vector<InjectedFault> FaultInjector::faults() const {
+    return acquireSnapshot().faults.faults();
+}
+
+size_t FaultInjector::faultCount() const {
+    return acquireSnapshot().faults.size();
+}
+
+InjectedFault FaultInjector::currentFault() const {
+    const std::vector<InjectedFault>& faults = acquireSnapshot().faults.faults();
+    return faults.empty() ? InjectedFault{} : faults.back();
+}
+
+void FaultInjector::reset() {
+    QMutexLocker locker(&_mutex);
+    _ticks.store(0, std::memory_order_relaxed);
+    publish(std::vector<InjectedFault>());
+}
+
+void FaultInjector::setTopology(const MemoryTopology& topology) {
+    QMutexLocker locker(&_mutex);
+    _topology = std::make_shared<MemoryTopology>(topology);
+    publish(_snapshot->faults.faults(), keptFaults(_snapshot->faults.size()));
+}
+
+std::shared_ptr<const MemoryTopology> FaultInjector::topology() const {
+    QMutexLocker locker(&_mutex);
+    return _topology;
+}
+
+std::shared_ptr<const FaultSnapshot> FaultInjector::snapshot() const {
+    QMutexLocker locker(&_mutex);
+    return _snapshot;
+}
+
+const FaultSnapshot& FaultInjector::acquireSnapshot() const {
+    SnapshotCache& cache = getThreadLocalSnapshotCache();
+    if (cache.version != _version.load(std::memory_order_acquire)) {
+        // Slow path: configuration changed since this thread last looked
+        QMutexLocker locker(&_mutex);
+        cache.snapshot = _snapshot;
+        cache.version = _snapshot->version;
+    }
+    return *cache.snapshot;
+}
+
+bool FaultInjector::isAddrFaulty(size_t addr) const {
+    return acquireSnapshot().isAddrFaulty(addr);
+}
+
+void FaultInjector::setReadPass(quint32 pass) {
+    _pass.store(pass, std::memory_order_relaxed);
+}
+
+quint32 FaultInjector::readPass() const {
+    return _pass.load(std::memory_order_relaxed);
+}
+
+Word FaultInjector::applyFault(size_t addr, Word storedValue) const {
+    const FaultSnapshot& snap = acquireSnapshot();
+    const FaultSet::Segment* seg = snap.faults.segmentAt(addr);
+    if (!seg) {
+        return storedValue;
+    }
+    return applySegment(snap, *seg, addr, storedValue);
+}
+
+size_t FaultInjector::applyFaultRange(size_t begin, Word* words, size_t count) const {
+    return applyFaultRange(begin, words, count, readPass());
+}
+
+size_t FaultInjector::applyFaultRange(size_t begin, Word* words, size_t count, quint32 pass) const {
+    const FaultSnapshot& snap = acquireSnapshot();
+    const FaultSet& set = snap.faults;
+    size_t end = begin + count;
+    if (!set.overlaps(begin, end)) return 0;
+    size_t applications = 0;
+    // Walk only the segments that intersect the range. Within a segment every fault
+    // is applied to the whole run of words at once (still in injection order per word),
+    // which lets BitFlip sample flips across the run instead of per word.
+    for (const FaultSet::Segment* seg = set.firstSegmentFrom(begin);
+         seg != set.segmentsEnd() && seg->begin < end; ++seg) {
+        size_t from = std::max(begin, seg->begin);
+        size_t to = std::min(end, seg->end);
+        if (seg->masked) {
+            // Fixed effects: one vector pass, no per-fault dispatch or RNG
+            if (seg->andMask != ~Word(0) || seg->xorMask != 0) {
+                CompareKernel::applyMask(words + (from - begin), to - from, seg->andMask, seg->xorMask);
+            }
+        } else {
+            for (const uint32_t* ref = set.refsBegin(*seg); ref != set.refsEnd(*seg); ++ref) {
+                applyFaultToRun(snap, *ref, from, words + (from - begin), to - from, pass);
+            }
+        }
+        applications += (to - from) * seg->refCount;
+    }
+    return applications;
+}
+
+bool FaultInjector::affectsWrites(size_t begin, size_t end) const {
+    return acquireSnapshot().faults.hasWriteFaultsIn(begin, end);
+}
+
+bool FaultInjector::remapsReads(size_t begin, size_t end) const {
+    return acquireSnapshot().faults.hasDecoderFaultsIn(begin, end);
+}
+
+void FaultInjector::applyDecoderRange(size_t begin, Word* words, size_t count, quint32 pass,
+                                      const FaultCellAccess& cells) const {
+    const FaultSnapshot& snap = acquireSnapshot();
+    const FaultSet& set = snap.faults;
+    std::pair<const size_t*, const size_t*> addrs = set.decodedAddrsIn(begin, begin + count);
+    for (const size_t* addr = addrs.first; addr != addrs.second; ++addr) {
+        const FaultSet::DecoderEntry& d = *set.decoderAt(*addr);
+        Word& word = words[*addr - begin];
+        switch (d.model) {
+            case FaultModel::AddressNoCell:
+                word = set.faults()[d.fault].forced_value;
+                break;
+            case FaultModel::AddressRemap:
+                word = readCell(snap, d.target, pass, cells);
+                break;
+            case FaultModel::AddressMulti:
+                word &= readCell(snap, d.target, pass, cells); // Both cells drive the bit lines
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+Word FaultInjector::readCell(const FaultSnapshot& snap, size_t cell, quint32 pass, const FaultCellAccess& cells) const {
+    Word v = cells.load(cell);
+    const FaultSet::Segment* seg = snap.faults.segmentAt(cell);
+    if (!seg) return v;
+    if (seg->masked) return (v & seg->andMask) ^ seg->xorMask;
+    for (const uint32_t* ref = snap.faults.refsBegin(*seg); ref != snap.faults.refsEnd(*seg); ++ref) {
+        // The cell's decoder entry concerns its address, not the cell itself
+        if (!isDecoderFault(snap.faults.faults()[*ref].model)) applyFaultToRun(snap, *ref, cell, &v, 1, pass);
+    }
+    return v;
+}
+
+void FaultInjector::applyWrite(size_t addr, Word value, FaultCellAccess& cells) const {
+    const FaultSnapshot& snap = acquireSnapshot();
+    const FaultSet::DecoderEntry* d = snap.faults.decoderAt(addr);
+    if (!d) {
+        writeCell(snap, addr, value, cells);
+        return;
+    }
+    switch (d->model) {
+        case FaultModel::AddressNoCell:
+            break; // The write is lost
+        case FaultModel::AddressRemap:
+            writeCell(snap, d->target, value, cells);
+            break;
+        case FaultModel::AddressMulti:
+            writeCell(snap, addr, value, cells);
+            writeCell(snap, d->target, value, cells);
+            break;
+        default:
+            writeCell(snap, addr, value, cells);
+            break;
+    }
+}
+
+void FaultInjector::writeCell(const FaultSnapshot& snap, size_t addr, Word value, FaultCellAccess& cells) const {
+    const FaultSet& set = snap.faults;
+    const Word old = cells.load(addr);
+    Word stored = value;
+    // Cell faults, in injection order
+    const FaultSet::Segment* seg = set.segmentAt(addr);
+    if (seg) {
+        for (const uint32_t* ref = set.refsBegin(*seg); ref != set.refsEnd(*seg); ++ref) {
+            const InjectedFault& f = set.faults()[*ref];
+            if (f.model == FaultModel::TransitionUp) {
+                stored &= old; // Bits cannot rise: 0 stays 0
+            } else if (f.model == FaultModel::TransitionDown) {
+                stored |= old; // Bits cannot fall: 1 stays 1
+            } else if (f.model == FaultModel::Retention) {
+                snap.retention.touch(*ref, addr - f.addr, clock());
+            }
+        }
+    }
+    // Victim side: CFst holds the victim while its aggressor is in the coupling state
+    FaultSet::CouplingRange victimOf = set.couplingsTo(addr);
+    for (const FaultSet::Coupling* c = victimOf.first; c != victimOf.second; ++c) {
+        const InjectedFault& f = set.faults()[c->fault];
+        if (f.model == FaultModel::CouplingState && cells.load(c->aggressor) == f.trigger_value) {
+            stored = f.forced_value;
+        }
+    }
+    // Base side: PNPSF keeps the old value, SNPSF the forced one while the pattern is present
+    FaultSet::NeighborhoodRange baseOf = set.neighborhoodsOf(addr);
+    for (const FaultSet::Neighborhood* n = baseOf.first; n != baseOf.second; ++n) {
+        const InjectedFault& f = set.faults()[n->fault];
+        if (f.model == FaultModel::NeighborhoodActive || !patternHolds(set, *n, f.trigger_value, cells)) continue;
+        stored = f.model == FaultModel::NeighborhoodPassive ? old : f.forced_value;
+    }
+    cells.store(addr, stored);
+
+    // Aggressor side, in injection order
+    const bool transition = old != stored;
+    FaultSet::CouplingRange aggressorOf = set.couplingsFrom(addr);
+    for (const FaultSet::Coupling* c = aggressorOf.first; c != aggressorOf.second; ++c) {
+        const InjectedFault& f = set.faults()[c->fault];
+        if (stored != f.trigger_value) continue;
+        switch (f.model) {
+            case FaultModel::CouplingInversion:
+                if (transition) cells.store(c->victim, ~cells.load(c->victim));
+                break;
+            case FaultModel::CouplingIdempotent:
+                if (transition) cells.store(c->victim, f.forced_value);
+                break;
+            case FaultModel::CouplingState:
+                cells.store(c->victim, f.forced_value);
+                break;
+            default:
+                break;
+        }
+    }
+    // Neighbor side: a write that completes the pattern acts on the base cell
+    FaultSet::NeighborhoodRefRange around = set.neighborhoodsAround(addr);
+    for (const uint32_t* ref = around.first; ref != around.second; ++ref) {
+        const FaultSet::Neighborhood& n = set.neighborhood(*ref);
+        const InjectedFault& f = set.faults()[n.fault];
+        if (stored != f.trigger_value || !patternHolds(set, n, f.trigger_value, cells)) continue;
+        if (f.model == FaultModel::NeighborhoodActive) {
+            if (transition) cells.store(n.base, ~cells.load(n.base));
+        } else if (f.model == FaultModel::NeighborhoodStatic) {
+            cells.store(n.base, f.forced_value);
+        }
+    }
+}
+
+bool FaultInjector::patternHolds(const FaultSet& set, const FaultSet::Neighborhood& n, Word pattern,
+                                 const FaultCellAccess& cells) {
+    for (const size_t* cell = set.neighborsBegin(n); cell != set.neighborsEnd(n); ++cell) {
+        if (cells.load(*cell) != pattern) return false;
+    }
+    return true;
+}
+
+void FaultInjector::applyFaultToRun(const FaultSnapshot& snap, uint32_t fault, size_t begin, Word* words,
+                                    size_t count, quint32 pass) const {
+    const InjectedFault& injected = snap.faults.faults()[fault];
+    if (injected.model == FaultModel::BitFlip) {
+        // For BitFlip, probability is checked per bit, not per address
+        applyBitFlips(injected, faultStreamKey(injected), begin, words, count, pass);
+        return;
+    }
+    if (injected.model == FaultModel::Retention) {
+        // Lazy decay: a cell not written for retention_ticks reads as the decayed value
+        const quint64 now = clock();
+        for (size_t i = 0; i < count; ++i) {
+            if (snap.retention.age(fault, begin + i - injected.addr, now) >= injected.retention_ticks) {
+                words[i] = injected.forced_value;
+            }
+        }
+        return;
+    }
+    // Already in the stored value, or applied by applyDecoderRange()
+    if (actsOnWrite(injected.model)) return;
+    if (injected.model != FaultModel::StuckAt0 && injected.model != FaultModel::StuckAt1 &&
+        injected.model != FaultModel::OpenRead) {
+        return;
+    }
+    // Ячеечные неисправности применяются при чтении; неисправности связи и переходов - при записи (applyWrite).
+    // flip_probability is the probability of applying the fault at address level, not per bit
+    FirstDrawCache firstDraw(faultStreamKey(injected), pass);
+    for (size_t i = 0; i < count; ++i) {
+        if (addressTriggered(injected, firstDraw, begin + i)) words[i] = addressFaultValue(injected.model, words[i]);
+    }
+}
+
+Word FaultInjector::applySegment(const FaultSnapshot& snap, const FaultSet::Segment& seg, size_t addr,
+                                 Word storedValue) const {
+    if (seg.masked) return (storedValue & seg.andMask) ^ seg.xorMask;
+    const quint32 pass = readPass();
+    const FaultSet& set = snap.faults;
+    Word v = storedValue;
+    for (const uint32_t* ref = set.refsBegin(seg); ref != set.refsEnd(seg); ++ref) {
+        applyFaultToRun(snap, *ref, addr, &v, 1, pass);
+    }
+    return v;
+}
@@ -0,0 +1,116 @@
+#ifndef FAULTINJECTOR_H
+#define FAULTINJECTOR_H
+
+#include <atomic>
+#include <memory>
+#include <QMutex>
+#include <QThreadStorage>
+#include "types.h"
+#include "faultset.h"
+#include "retentionstamps.h"
+
+// Immutable fault configuration published by FaultInjector.
+// A new snapshot is built on every change; readers never see partial updates.
+struct FaultSnapshot {
+    FaultSet faults;
+    // The only mutable part: last-write times of retention-faulty cells. The table of a
+    // fault is shared with the snapshots before and after it, so its timers keep running
+    // when other faults are injected or removed; reset() starts from an empty set.
+    mutable RetentionStamps retention;
+    // Topology the neighborhoods of the fault set were resolved with
+    std::shared_ptr<const MemoryTopology> topology;
+    quint64 version = 0; // Globally unique, used by per-thread caches
+
+    bool isAddrFaulty(size_t addr) const { return faults.isAddrFaulty(addr); }
+};
+
+// Storage cells as seen by write-path faults: a write to one cell may change others
+class FaultCellAccess {
+public:
+    virtual ~FaultCellAccess() = default;
+    virtual Word load(size_t addr) const = 0;
+    virtual void store(size_t addr, Word value) = 0;
+};
+
+class FaultInjector {
+public:
+    FaultInjector();
+    ~FaultInjector() = default;
+
+    // Управление неисправностями (writers: build a new snapshot and swap it in).
+    // Faults accumulate; overlapping faults are applied in injection order.
+    // False (nothing injected) when MAX_FAULTS faults are already present.
+    bool injectFault(const InjectedFault& f);
+    bool removeFault(size_t index);
+    std::vector<InjectedFault> faults() const;
+    size_t faultCount() const;
+    InjectedFault currentFault() const; // Most recently injected fault (FaultModel::None if empty)
+    void reset(); // Removes all faults; the topology is kept
+    // Physical layout for neighborhood faults; republishes the faults with the new neighbors
+    void setTopology(const MemoryTopology& topology);
+    std::shared_ptr<const MemoryTopology> topology() const;
+
+    // Применение неисправностей (readers: lock-free on the hot path)
+    Word applyFault(size_t addr, Word storedValue) const;
+    // Applies faults in place to words[0..count) read from addresses [begin, begin + count).
+    // Returns the number of fault applications (faulty words, once per covering fault).
+    size_t applyFaultRange(size_t begin, Word* words, size_t count) const;
+    // Same with an explicit read pass, for concurrent readers working on different passes
+    size_t applyFaultRange(size_t begin, Word* words, size_t count, quint32 pass) const;
+    bool isAddrFaulty(size_t addr) const;
+
+    // Address decoder faults on the read path. True if [begin, end) holds a remapped address.
+    bool remapsReads(size_t begin, size_t end) const;
+    // Replaces the words of remapped addresses in words[0..count) with what the faulty decoder
+    // reads: the selected cell (with its cell faults), the AND of both cells, or forced_value
+    // when no cell is selected. Called after applyFaultRange() with the same pass.
+    void applyDecoderRange(size_t begin, Word* words, size_t count, quint32 pass, const FaultCellAccess& cells) const;
+
+    // Write path. True if a write to [begin, end) may touch a cell with a write-path
+    // fault (coupling, transition, retention, decoder, neighborhood); other writes go
+    // straight to storage.
+    bool affectsWrites(size_t begin, size_t end) const;
+    // Stores value at addr through cells, applying write-path faults: the decoder selects
+    // the cell(s) written, transition faults block bit changes, a state-coupled victim keeps
+    // its forced value, a base cell holds its value or the forced one while its neighbors form
+    // the pattern, retention stamps are renewed, and a write to an aggressor or a neighbor
+    // changes its victims or base cells. Effects do not propagate further (a changed victim
+    // does not act as an aggressor).
+    void applyWrite(size_t addr, Word value, FaultCellAccess& cells) const;
+
+    // Simulated clock for retention faults. The tester advances it by one tick per march
+    // element and by the length of every delay element; reset() sets it back to zero.
+    void advanceClock(quint64 ticks) { _ticks.fetch_add(ticks, std::memory_order_relaxed); }
+    quint64 clock() const { return _ticks.load(std::memory_order_relaxed); }
+
+    // Read pass number: part of the RNG counter, so repeated reads of an address
+    // within one pass give the same outcome and different passes are independent
+    void setReadPass(quint32 pass);
+    quint32 readPass() const;
+
+    // Current configuration; stays valid for as long as the caller holds it
+    std::shared_ptr<const FaultSnapshot> snapshot() const;
+
+private:
+    // Caller holds _mutex. previousIndex[i] is the index of faults[i] in the current snapshot
+    // (RetentionStamps::NEW_FAULT for a new fault); retention stamps follow their fault.
+    void publish(const std::vector<InjectedFault>& faults,
+                 const std::vector<size_t>& previousIndex = std::vector<size_t>());
+    const FaultSnapshot& acquireSnapshot() const; // Thread-cached, see faultinjector.cpp
+    void applyFaultToRun(const FaultSnapshot& snap, uint32_t fault, size_t begin, Word* words, size_t count,
+                         quint32 pass) const;
+    Word applySegment(const FaultSnapshot& snap, const FaultSet::Segment& seg, size_t addr, Word storedValue) const;
+    Word readCell(const FaultSnapshot& snap, size_t cell, quint32 pass, const FaultCellAccess& cells) const;
+    void writeCell(const FaultSnapshot& snap, size_t cell, Word value, FaultCellAccess& cells) const;
+    static bool patternHolds(const FaultSet& set, const FaultSet::Neighborhood& n, Word pattern,
+                             const FaultCellAccess& cells);
+
+    mutable QMutex _mutex; // Serializes writers and per-thread cache refreshes only
+    std::shared_ptr<const FaultSnapshot> _snapshot;
+    std::shared_ptr<const MemoryTopology> _topology;
+    std::atomic<quint64> _version;
+    std::atomic<quint32> _pass;
+    std::atomic<quint64> _ticks;
+};
+
+#endif // FAULTINJECTOR_H
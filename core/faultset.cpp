@@ -0,0 +1,272 @@
+#include "faultset.h"
+#include "constants.h"
+#include <algorithm>
+#include <limits>
+#include <set>
+
+namespace {
+
+struct Boundary {
+    size_t addr;
+    uint32_t fault;
+    bool opens;
+};
+
+size_t faultEnd(const InjectedFault& f) {
+    // Saturate instead of wrapping around for ranges that reach the end of size_t
+    size_t maxEnd = std::numeric_limits<size_t>::max();
+    return f.len > maxEnd - f.addr ? maxEnd : f.addr + f.len;
+}
+
+// Read effect of f as value = (value & andMask) ^ xorMask, if it does not depend on
+// the address, the read pass or the clock
+bool readMask(const InjectedFault& f, Word& andMask, Word& xorMask) {
+    andMask = ~Word(0);
+    xorMask = 0;
+    switch (f.model) {
+        case FaultModel::StuckAt0:
+        case FaultModel::StuckAt1:
+        case FaultModel::OpenRead:
+            // The per-address trial uses u in (0, 1]: p >= 1 always fires, p <= 0 never does
+            if (f.flip_probability <= 0.0) return true;
+            if (f.flip_probability < 1.0) return false;
+            andMask = 0;
+            xorMask = f.model == FaultModel::StuckAt0 ? 0u
+                    : f.model == FaultModel::StuckAt1 ? ~Word(0) : Word(INVALID_READ_MARKER);
+            return true;
+        case FaultModel::BitFlip:
+            if (f.flip_probability <= 0.0) return true;
+            if (f.flip_probability < 1.0) return false;
+            xorMask = ~Word(0);
+            return true;
+        case FaultModel::Retention:
+            return false;
+        default:
+            return true; // Write-path and decoder models do not change the word read
+    }
+}
+
+} // namespace
+
+FaultSet::FaultSet(const std::vector<InjectedFault>& faults, const MemoryTopology& topology)
+    : _faults(faults), _low(0), _high(0) {
+    // Sweep line over fault boundaries
+    std::vector<Boundary> bounds;
+    bounds.reserve(_faults.size() * 2);
+    for (size_t i = 0; i < _faults.size(); ++i) {
+        const InjectedFault& f = _faults[i];
+        if (f.model == FaultModel::None || f.len == 0) continue;
+        bounds.push_back({f.addr, uint32_t(i), true});
+        bounds.push_back({faultEnd(f), uint32_t(i), false});
+    }
+    std::sort(bounds.begin(), bounds.end(), [](const Boundary& a, const Boundary& b) {
+        return a.addr < b.addr;
+    });
+
+    std::set<uint32_t> active; // ordered by fault index = injection order
+    size_t i = 0;
+    while (i < bounds.size()) {
+        size_t addr = bounds[i].addr;
+        for (; i < bounds.size() && bounds[i].addr == addr; ++i) {
+            if (bounds[i].opens) active.insert(bounds[i].fault);
+            else active.erase(bounds[i].fault);
+        }
+        if (active.empty() || i == bounds.size()) continue;
+
+        Segment s;
+        s.begin = addr;
+        s.end = bounds[i].addr;
+        s.firstRef = uint32_t(_refs.size());
+        s.refCount = uint32_t(active.size());
+        s.masked = true;
+        s.andMask = ~Word(0);
+        s.xorMask = 0;
+        for (uint32_t fault : active) {
+            // Compose in injection order: ((v & a1) ^ x1) & a2 ^ x2 = (v & a1 & a2) ^ ((x1 & a2) ^ x2)
+            Word andMask, xorMask;
+            if (!readMask(_faults[fault], andMask, xorMask)) {
+                s.masked = false;
+                break;
+            }
+            s.andMask &= andMask;
+            s.xorMask = (s.xorMask & andMask) ^ xorMask;
+        }
+        _refs.insert(_refs.end(), active.begin(), active.end());
+        _segments.push_back(s);
+    }
+
+    if (!_segments.empty()) {
+        _low = _segments.front().begin;
+        _high = _segments.back().end;
+    }
+    indexCouplings();
+    indexDecoder();
+    indexNeighborhoods(topology);
+    indexWriteSpans();
+    std::sort(_linkedCells.begin(), _linkedCells.end());
+    _linkedCells.erase(std::unique(_linkedCells.begin(), _linkedCells.end()), _linkedCells.end());
+}
+
+void FaultSet::indexDecoder() {
+    for (size_t i = 0; i < _faults.size(); ++i) {
+        const InjectedFault& f = _faults[i];
+        if (!isDecoderFault(f.model)) continue;
+        size_t maxEnd = std::numeric_limits<size_t>::max();
+        size_t count = f.model == FaultModel::AddressNoCell
+                     ? std::min(f.len, maxEnd - f.addr)
+                     : std::min(f.len, maxEnd - std::max(f.addr, f.target_addr));
+        for (size_t k = 0; k < count; ++k) {
+            DecoderEntry entry = {f.model, f.target_addr + k, uint32_t(i)};
+            if (f.model != FaultModel::AddressNoCell && entry.target == f.addr + k) continue; // Decodes correctly
+            _decoder[f.addr + k] = entry; // Later faults replace earlier ones
+        }
+    }
+    _decodedAddrs.reserve(_decoder.size());
+    for (const DecoderTable::value_type& e : _decoder) {
+        _decodedAddrs.push_back(e.first);
+        _linkedCells.push_back(e.first);
+        if (e.second.model != FaultModel::AddressNoCell) _linkedCells.push_back(e.second.target);
+    }
+    std::sort(_decodedAddrs.begin(), _decodedAddrs.end());
+}
+
+void FaultSet::indexNeighborhoods(const MemoryTopology& topology) {
+    std::vector<std::pair<size_t, uint32_t>> around; // (neighbor cell, neighborhood)
+    for (size_t i = 0; i < _faults.size(); ++i) {
+        const InjectedFault& f = _faults[i];
+        if (!isNeighborhoodFault(f.model)) continue;
+        // Base cells outside the topology have no neighbors
+        size_t count = f.addr < topology.words() ? std::min(f.len, topology.words() - f.addr) : 0;
+        for (size_t k = 0; k < count; ++k) {
+            size_t cells[8];
+            int found = topology.neighbors(f.addr + k, f.neighborhood, cells);
+            if (found == 0) continue;
+            Neighborhood n = {f.addr + k, uint32_t(i), uint32_t(_neighborCells.size()), uint32_t(found)};
+            _neighborCells.insert(_neighborCells.end(), cells, cells + found);
+            _neighborhoods.push_back(n);
+        }
+    }
+    if (_neighborhoods.empty()) return;
+
+    std::stable_sort(_neighborhoods.begin(), _neighborhoods.end(), [](const Neighborhood& a, const Neighborhood& b) {
+        return a.base < b.base;
+    });
+    around.reserve(_neighborCells.size());
+    for (uint32_t i = 0; i < _neighborhoods.size(); ++i) {
+        const Neighborhood& n = _neighborhoods[i];
+        std::pair<uint32_t, uint32_t>& entry = _baseIndex.insert({n.base, {i, 0}}).first->second;
+        ++entry.second;
+        _linkedCells.push_back(n.base);
+        for (const size_t* cell = neighborsBegin(n); cell != neighborsEnd(n); ++cell) {
+            around.push_back(std::make_pair(*cell, i));
+            _linkedCells.push_back(*cell);
+        }
+    }
+    std::stable_sort(around.begin(), around.end(), [](const std::pair<size_t, uint32_t>& a,
+                                                      const std::pair<size_t, uint32_t>& b) {
+        return a.first < b.first;
+    });
+    _aroundRefs.reserve(around.size());
+    for (uint32_t i = 0; i < around.size(); ++i) {
+        std::pair<uint32_t, uint32_t>& entry = _aroundIndex.insert({around[i].first, {i, 0}}).first->second;
+        ++entry.second;
+        _aroundRefs.push_back(around[i].second);
+    }
+}
+
+void FaultSet::indexWriteSpans() {
+    for (const InjectedFault& f : _faults) {
+        if (f.len == 0 || !(isTransitionFault(f.model) || f.model == FaultModel::Retention)) continue;
+        _writeSpans.push_back(std::make_pair(f.addr, faultEnd(f)));
+    }
+    std::sort(_writeSpans.begin(), _writeSpans.end());
+    size_t merged = 0;
+    for (size_t i = 0; i < _writeSpans.size(); ++i) {
+        if (merged > 0 && _writeSpans[i].first <= _writeSpans[merged - 1].second) {
+            _writeSpans[merged - 1].second = std::max(_writeSpans[merged - 1].second, _writeSpans[i].second);
+        } else {
+            _writeSpans[merged++] = _writeSpans[i];
+        }
+    }
+    _writeSpans.resize(merged);
+}
+
+bool FaultSet::overlapsWriteSpan(size_t begin, size_t end) const {
+    if (_writeSpans.empty() || begin >= end) return false;
+    // First span ending after begin
+    auto it = std::upper_bound(_writeSpans.begin(), _writeSpans.end(), begin,
+                               [](size_t a, const std::pair<size_t, size_t>& s) { return a < s.second; });
+    return it != _writeSpans.end() && it->first < end;
+}
+
+void FaultSet::indexCouplings() {
+    for (size_t i = 0; i < _faults.size(); ++i) {
+        const InjectedFault& f = _faults[i];
+        if (!isCouplingFault(f.model)) continue;
+        // Pairs stay inside the address space on both sides
+        size_t maxEnd = std::numeric_limits<size_t>::max();
+        size_t pairs = std::min(f.len, maxEnd - std::max(f.addr, f.aggressor_addr));
+        for (size_t k = 0; k < pairs; ++k) {
+            if (f.aggressor_addr + k == f.addr + k) continue; // A cell cannot couple to itself
+            _byAggressor.push_back({f.aggressor_addr + k, f.addr + k, uint32_t(i)});
+        }
+    }
+    if (_byAggressor.empty()) return;
+
+    _byVictim = _byAggressor;
+    std::stable_sort(_byAggressor.begin(), _byAggressor.end(), [](const Coupling& a, const Coupling& b) {
+        return a.aggressor < b.aggressor;
+    });
+    std::stable_sort(_byVictim.begin(), _byVictim.end(), [](const Coupling& a, const Coupling& b) {
+        return a.victim < b.victim;
+    });
+    for (uint32_t i = 0; i < _byAggressor.size(); ++i) {
+        std::pair<uint32_t, uint32_t>& entry = _aggressorIndex.insert({_byAggressor[i].aggressor, {i, 0}}).first->second;
+        ++entry.second;
+    }
+    for (uint32_t i = 0; i < _byVictim.size(); ++i) {
+        std::pair<uint32_t, uint32_t>& entry = _victimIndex.insert({_byVictim[i].victim, {i, 0}}).first->second;
+        ++entry.second;
+    }
+
+    _linkedCells.reserve(_byAggressor.size() * 2);
+    for (const Coupling& c : _byAggressor) {
+        _linkedCells.push_back(c.aggressor);
+        _linkedCells.push_back(c.victim);
+    }
+}
+
+FaultSet::CouplingRange FaultSet::lookup(const std::vector<Coupling>& couplings, const AddressIndex& index,
+                                         size_t addr) {
+    const AddressIndex::value_type* entry = find(index, addr);
+    if (!entry) return CouplingRange(nullptr, nullptr);
+    const Coupling* first = couplings.data() + entry->second.first;
+    return CouplingRange(first, first + entry->second.second);
+}
+
+std::pair<const size_t*, const size_t*> FaultSet::sortedIn(const std::vector<size_t>& sorted, size_t begin,
+                                                          size_t end) {
+    const size_t* sortedEnd = sorted.data() + sorted.size();
+    if (sorted.empty() || begin >= end || end <= sorted.front() || begin > sorted.back()) {
+        return std::make_pair(sortedEnd, sortedEnd);
+    }
+    const size_t* first = std::lower_bound(sorted.data(), sortedEnd, begin);
+    const size_t* last = std::lower_bound(first, sortedEnd, end);
+    return std::make_pair(first, last);
+}
+
+const FaultSet::Segment* FaultSet::findSegment(size_t addr) const {
+    // Last segment starting at or before addr
+    auto it = std::upper_bound(_segments.begin(), _segments.end(), addr,
+                               [](size_t a, const Segment& s) { return a < s.begin; });
+    if (it == _segments.begin()) return nullptr;
+    --it;
+    return addr < it->end ? &*it : nullptr;
+}
+
+const FaultSet::Segment* FaultSet::firstSegmentFrom(size_t addr) const {
+    auto it = std::upper_bound(_segments.begin(), _segments.end(), addr,
+                               [](size_t a, const Segment& s) { return a < s.begin; });
+    if (it != _segments.begin() && addr < (it - 1)->end) --it;
+    return _segments.data() + (it - _segments.begin());
+}
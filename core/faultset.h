@@ -0,0 +1,188 @@
+#ifndef FAULTSET_H
+#define FAULTSET_H
+
+#include <vector>
+#include <unordered_map>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+#include "types.h"
+#include "memorytopology.h"
+
+// Immutable set of injected faults with an address index.
+// The address space covered by faults is split into sorted, non-overlapping
+// segments; every address of a segment is covered by the same list of faults.
+// Lookups are a binary search over segment starts (O(log k)), and the common
+// "no fault here" case is usually rejected by the bounding range alone.
+//
+// Coupling faults additionally get a pair index: a hash from aggressor (and victim)
+// address to its couplings. Address decoder faults get a sparse remap table from
+// address to decoder entry. Neighborhood faults get the physical neighbors of every
+// base cell, resolved once through the memory topology when the set is built, and an
+// index from each neighbor back to the neighborhoods it belongs to. Cells touched by
+// any of these (aggressors, victims, remapped addresses and their targets, base cells
+// and their neighbors) form the sorted list of linked cells. Segments cover victims,
+// remapped addresses and base cells, so those count as faulty addresses. Transition and
+// retention faults are kept as merged address spans; together with the linked cells
+// they are the cells whose writes have to go through the injector.
+//
+// Read effects are compiled per segment: when every fault of a segment has a fixed
+// effect on reads (stuck-at and open-read at probability 1, bit-flip at probability
+// 0 or 1, and the write-path models, which leave reads alone), the faults collapse
+// into one AND/XOR mask pair. Only segments with random or time-dependent faults
+// need the per-fault path.
+class FaultSet {
+public:
+    struct Segment {
+        size_t begin;
+        size_t end;          // exclusive
+        uint32_t firstRef;   // index into refs(); fits 32 bits for MAX_FAULTS faults
+        uint32_t refCount;   // number of faults covering the segment
+        // Compiled read effect: a read of the segment returns (stored & andMask) ^ xorMask
+        bool masked;
+        Word andMask;
+        Word xorMask;
+    };
+
+    struct Coupling {
+        size_t aggressor;
+        size_t victim;
+        uint32_t fault; // index into faults()
+    };
+    using CouplingRange = std::pair<const Coupling*, const Coupling*>;
+
+    struct DecoderEntry {
+        FaultModel model; // AddressNoCell, AddressRemap or AddressMulti
+        size_t target;    // Cell selected instead of (Remap) or in addition to (Multi) the own cell
+        uint32_t fault;   // index into faults()
+    };
+
+    struct Neighborhood {
+        size_t base;
+        uint32_t fault;         // index into faults()
+        uint32_t firstNeighbor; // index into the neighbor cell list
+        uint32_t neighborCount;
+    };
+    using NeighborhoodRange = std::pair<const Neighborhood*, const Neighborhood*>;
+    using NeighborhoodRefRange = std::pair<const uint32_t*, const uint32_t*>;
+
+    FaultSet() : _low(0), _high(0) {}
+    // Neighbors of neighborhood faults are taken from topology
+    FaultSet(const std::vector<InjectedFault>& faults, const MemoryTopology& topology);
+
+    const std::vector<InjectedFault>& faults() const { return _faults; }
+    size_t size() const { return _faults.size(); }
+    bool empty() const { return _segments.empty(); }
+
+    // Fault indices (in injection order) covering a segment
+    const uint32_t* refsBegin(const Segment& s) const { return _refs.data() + s.firstRef; }
+    const uint32_t* refsEnd(const Segment& s) const { return _refs.data() + s.firstRef + s.refCount; }
+
+    // Segment containing addr, or nullptr
+    const Segment* segmentAt(size_t addr) const {
+        if (addr < _low || addr >= _high) return nullptr; // fast rejection
+        return findSegment(addr);
+    }
+    bool isAddrFaulty(size_t addr) const { return segmentAt(addr) != nullptr; }
+
+    // First segment that ends after addr (segments are sorted), or segments end
+    const Segment* firstSegmentFrom(size_t addr) const;
+    const Segment* segmentsEnd() const { return _segments.data() + _segments.size(); }
+    bool overlaps(size_t begin, size_t end) const { return begin < _high && end > _low && begin < end; }
+
+    bool hasCouplings() const { return !_byAggressor.empty(); }
+    // Couplings whose aggressor (victim) is addr, in injection order
+    CouplingRange couplingsFrom(size_t addr) const { return lookup(_byAggressor, _aggressorIndex, addr); }
+    CouplingRange couplingsTo(size_t addr) const { return lookup(_byVictim, _victimIndex, addr); }
+
+    // Decoder entry of addr, nullptr for a correctly decoded address.
+    // Of several decoder faults on one address the most recently injected one applies.
+    const DecoderEntry* decoderAt(size_t addr) const {
+        if (_decoder.empty()) return nullptr;
+        DecoderTable::const_iterator it = _decoder.find(addr);
+        return it != _decoder.end() ? &it->second : nullptr;
+    }
+    // Addresses in [begin, end) with a decoder entry, ascending
+    std::pair<const size_t*, const size_t*> decodedAddrsIn(size_t begin, size_t end) const {
+        return sortedIn(_decodedAddrs, begin, end);
+    }
+    bool hasDecoderFaultsIn(size_t begin, size_t end) const {
+        std::pair<const size_t*, const size_t*> addrs = decodedAddrsIn(begin, end);
+        return addrs.first != addrs.second;
+    }
+
+    // Neighborhoods whose base cell is addr, in injection order
+    NeighborhoodRange neighborhoodsOf(size_t base) const {
+        const AddressIndex::value_type* entry = find(_baseIndex, base);
+        if (!entry) return NeighborhoodRange(nullptr, nullptr);
+        const Neighborhood* first = _neighborhoods.data() + entry->second.first;
+        return NeighborhoodRange(first, first + entry->second.second);
+    }
+    // Indices (see neighborhood()) of the neighborhoods that have addr as a neighbor
+    NeighborhoodRefRange neighborhoodsAround(size_t addr) const {
+        const AddressIndex::value_type* entry = find(_aroundIndex, addr);
+        if (!entry) return NeighborhoodRefRange(nullptr, nullptr);
+        const uint32_t* first = _aroundRefs.data() + entry->second.first;
+        return NeighborhoodRefRange(first, first + entry->second.second);
+    }
+    const Neighborhood& neighborhood(uint32_t index) const { return _neighborhoods[index]; }
+    const size_t* neighborsBegin(const Neighborhood& n) const { return _neighborCells.data() + n.firstNeighbor; }
+    const size_t* neighborsEnd(const Neighborhood& n) const { return neighborsBegin(n) + n.neighborCount; }
+
+    // Cells linked to other cells by coupling, decoder or neighborhood faults. An access to one of them
+    // may change another, so operations on them have to run in address order.
+    bool hasLinkedCells() const { return !_linkedCells.empty(); }
+    std::pair<const size_t*, const size_t*> linkedCellsIn(size_t begin, size_t end) const {
+        return sortedIn(_linkedCells, begin, end);
+    }
+    bool hasLinkedCellsIn(size_t begin, size_t end) const {
+        std::pair<const size_t*, const size_t*> cells = linkedCellsIn(begin, end);
+        return cells.first != cells.second;
+    }
+
+    bool hasWriteFaults() const { return hasLinkedCells() || !_writeSpans.empty(); }
+    // True if a write into [begin, end) has to go through FaultInjector::applyWrite
+    bool hasWriteFaultsIn(size_t begin, size_t end) const {
+        return hasWriteFaults() && (hasLinkedCellsIn(begin, end) || overlapsWriteSpan(begin, end));
+    }
+
+private:
+    using AddressIndex = std::unordered_map<size_t, std::pair<uint32_t, uint32_t>>; // addr -> (first, count)
+    using DecoderTable = std::unordered_map<size_t, DecoderEntry>;
+
+    const Segment* findSegment(size_t addr) const;
+    void indexCouplings();
+    void indexDecoder();
+    void indexNeighborhoods(const MemoryTopology& topology);
+    void indexWriteSpans();
+    bool overlapsWriteSpan(size_t begin, size_t end) const;
+    static CouplingRange lookup(const std::vector<Coupling>& couplings, const AddressIndex& index, size_t addr);
+    static const AddressIndex::value_type* find(const AddressIndex& index, size_t addr) {
+        if (index.empty()) return nullptr;
+        AddressIndex::const_iterator it = index.find(addr);
+        return it != index.end() ? &*it : nullptr;
+    }
+    static std::pair<const size_t*, const size_t*> sortedIn(const std::vector<size_t>& sorted, size_t begin, size_t end);
+
+    std::vector<InjectedFault> _faults;
+    std::vector<Segment> _segments;
+    std::vector<uint32_t> _refs;
+    size_t _low;   // Bounding range of all segments
+    size_t _high;
+
+    std::vector<Coupling> _byAggressor; // Sorted by aggressor, then injection order
+    std::vector<Coupling> _byVictim;    // Sorted by victim, then injection order
+    AddressIndex _aggressorIndex;
+    AddressIndex _victimIndex;
+    DecoderTable _decoder;
+    std::vector<size_t> _decodedAddrs;  // Sorted
+    std::vector<Neighborhood> _neighborhoods; // Sorted by base, then injection order
+    std::vector<size_t> _neighborCells;
+    std::vector<uint32_t> _aroundRefs;  // Neighborhood indices grouped by neighbor cell
+    AddressIndex _baseIndex;
+    AddressIndex _aroundIndex;
+    std::vector<size_t> _linkedCells;   // Sorted, unique
+    std::vector<std::pair<size_t, size_t>> _writeSpans; // Transition/retention ranges, sorted and merged
+};
+
+#endif // FAULTSET_H
@@ -0,0 +1,251 @@
+#include "marchtest.h"
+#include "constants.h"
+#include <QStringList>
+
+namespace {
+
+// Built-in algorithm table. "0" in the notation is the data background D(addr),
+// "1" is its inverse, so Walking 1s/0s are the same two-element march over a
+// walking background.
+struct BuiltinAlgorithm {
+    const char* id;
+    const char* name;
+    const char* notation;
+    DataBackground background;
+    const char* description;
+};
+
+const BuiltinAlgorithm BUILTIN_ALGORITHMS[] = {
+    { "walking-ones", "Walking 1s", "{⇑(w0); ⇑(r0)}", DataBackground::WalkingOnes,
+      "Записывает единицу в каждый бит позиции и проверяет, что она сохраняется. "
+      "Обнаруживает залипания битов и ошибки чтения/записи." },
+    { "walking-zeros", "Walking 0s", "{⇑(w0); ⇑(r0)}", DataBackground::WalkingZeros,
+      "Записывает ноль в каждый бит позиции и проверяет, что он сохраняется. "
+      "Обнаруживает залипания битов и ошибки чтения/записи." },
+    { "march-simple", "March - simple", "{⇑(w0); ⇑(r0); ⇑(w1); ⇑(r1)}", DataBackground::Solid,
+      "Простой маршевый тест: записывает все нули, проверяет нули, "
+      "записывает все единицы, проверяет единицы. Обнаруживает основные неисправности памяти." },
+    { "mats-plus", "MATS+", "{⇕(w0); ⇑(r0,w1); ⇓(r1,w0)}", DataBackground::Solid,
+      "Сложность 5n. Обнаруживает все константные неисправности (SAF) "
+      "и неисправности дешифратора адреса (AF)." },
+    { "march-x", "March X", "{⇕(w0); ⇑(r0,w1); ⇓(r1,w0); ⇕(r0)}", DataBackground::Solid,
+      "Сложность 6n. Обнаруживает SAF, AF, неисправности переходов (TF) "
+      "и инверсные неисправности связи (CFin)." },
+    { "march-y", "March Y", "{⇕(w0); ⇑(r0,w1,r1); ⇓(r1,w0,r0); ⇕(r0)}", DataBackground::Solid,
+      "Сложность 8n. Расширение March X с повторным чтением после записи: "
+      "дополнительно обнаруживает связанные неисправности переходов." },
+    { "march-c-minus", "March C-", "{⇕(w0); ⇑(r0,w1); ⇑(r1,w0); ⇓(r0,w1); ⇓(r1,w0); ⇕(r0)}", DataBackground::Solid,
+      "Сложность 10n. Обнаруживает SAF, AF, TF и все несвязанные неисправности связи "
+      "(CFin, CFid, CFst)." },
+    { "march-b", "March B", "{⇕(w0); ⇑(r0,w1,r1,w0,r0,w1); ⇑(r1,w0,w1); ⇓(r1,w0,w1,w0); ⇓(r0,w1,w0)}",
+      DataBackground::Solid,
+      "Сложность 17n. Обнаруживает SAF, AF, TF, связанные с ними CF "
+      "и часть связанных неисправностей связи." },
+    { "march-ss", "March SS",
+      "{⇕(w0); ⇑(r0,r0,w0,r0,w1); ⇑(r1,r1,w1,r1,w0); ⇓(r0,r0,w0,r0,w1); ⇓(r1,r1,w1,r1,w0); ⇕(r0)}",
+      DataBackground::Solid,
+      "Сложность 22n. Обнаруживает все статические простые неисправности: "
+      "в том числе неисправности деструктивного и ложного чтения (RDF, DRDF, IRF)." },
+    { "march-g", "March G",
+      "{⇕(w0); ⇑(r0,w1,r1,w0,r0,w1); ⇑(r1,w0,w1); ⇓(r1,w0,w1,w0); ⇓(r0,w1,w0); Del; ⇕(r0,w1,r1); Del; ⇕(r1,w0,r0)}",
+      DataBackground::Solid,
+      "Сложность 23n + 2 задержки. March B с элементами задержки: дополнительно обнаруживает "
+      "неисправности хранения (DRF) в обоих состояниях ячейки." },
+};
+
+// Minimal recursive-descent parser over a QString
+class NotationReader {
+public:
+    explicit NotationReader(const QString& text) : _text(text), _pos(0) {}
+
+    void skipSpaces() {
+        while (_pos < _text.size() && _text.at(_pos).isSpace()) ++_pos;
+    }
+    bool atEnd() { skipSpaces(); return _pos >= _text.size(); }
+    int position() const { return _pos + 1; }
+
+    bool accept(QChar c) {
+        skipSpaces();
+        if (_pos < _text.size() && _text.at(_pos) == c) { ++_pos; return true; }
+        return false;
+    }
+
+    bool acceptWord(const QString& word) {
+        skipSpaces();
+        // Keywords are a few characters long: the copy is cheaper than a version-dependent view
+        if (_text.mid(_pos, word.size()).compare(word, Qt::CaseInsensitive) == 0) {
+            _pos += word.size();
+            return true;
+        }
+        return false;
+    }
+
+    bool readOrder(AddressOrder& order) {
+        skipSpaces();
+        if (_pos >= _text.size()) return false;
+        ushort c = _text.at(_pos).unicode();
+        if (c == 0x21D1 || c == 0x2191) { ++_pos; order = AddressOrder::Up; return true; }
+        if (c == 0x21D3 || c == 0x2193) { ++_pos; order = AddressOrder::Down; return true; }
+        if (c == 0x21D5 || c == 0x2195) { ++_pos; order = AddressOrder::Any; return true; }
+        if (acceptWord("up")) { order = AddressOrder::Up; return true; }
+        if (acceptWord("down")) { order = AddressOrder::Down; return true; }
+        if (acceptWord("any")) { order = AddressOrder::Any; return true; }
+        return false;
+    }
+
+    bool readNumber(quint64& value) {
+        skipSpaces();
+        int start = _pos;
+        while (_pos < _text.size() && _text.at(_pos).isDigit()) ++_pos;
+        bool ok = false;
+        value = _text.mid(start, _pos - start).toULongLong(&ok);
+        return ok;
+    }
+
+    bool readOp(MarchOp& op) {
+        skipSpaces();
+        if (_pos + 1 >= _text.size()) return false;
+        QChar kind = _text.at(_pos).toLower();
+        QChar value = _text.at(_pos + 1);
+        if ((kind != 'r' && kind != 'w') || (value != '0' && value != '1')) return false;
+        op.write = (kind == 'w');
+        op.inverted = (value == '1');
+        _pos += 2;
+        return true;
+    }
+
+private:
+    const QString& _text;
+    int _pos;
+};
+
+bool fail(QString* errorMessage, const QString& message) {
+    if (errorMessage) *errorMessage = message;
+    return false;
+}
+
+} // namespace
+
+size_t MarchAlgorithm::opsPerWord() const {
+    size_t ops = 0;
+    for (const auto& e : elements) ops += e.ops.size();
+    return ops;
+}
+
+size_t MarchAlgorithm::readsPerWord() const {
+    size_t reads = 0;
+    for (const auto& e : elements) {
+        for (const auto& op : e.ops) if (!op.write) ++reads;
+    }
+    return reads;
+}
+
+bool MarchParser::parse(const QString& notation, std::vector<MarchElement>& elements, QString* errorMessage) {
+    elements.clear();
+    NotationReader in(notation);
+    bool braced = in.accept('{');
+
+    do {
+        MarchElement element;
+        if (in.acceptWord("del")) {
+            element.delay = DEFAULT_DELAY_TICKS;
+            if (in.accept('(')) {
+                if (!in.readNumber(element.delay) || element.delay == 0) {
+                    return fail(errorMessage, QString("Позиция %1: ожидалась длительность задержки в тактах").arg(in.position()));
+                }
+                if (!in.accept(')')) {
+                    return fail(errorMessage, QString("Позиция %1: ожидалась ')'").arg(in.position()));
+                }
+            }
+            elements.push_back(element);
+            continue;
+        }
+        if (!in.readOrder(element.order)) {
+            return fail(errorMessage, QString("Позиция %1: ожидался порядок адресов (⇑, ⇓, ⇕) или Del").arg(in.position()));
+        }
+        if (!in.accept('(')) {
+            return fail(errorMessage, QString("Позиция %1: ожидалась '('").arg(in.position()));
+        }
+        do {
+            MarchOp op;
+            if (!in.readOp(op)) {
+                return fail(errorMessage, QString("Позиция %1: ожидалась операция r0, r1, w0 или w1").arg(in.position()));
+            }
+            element.ops.push_back(op);
+        } while (in.accept(','));
+        if (!in.accept(')')) {
+            return fail(errorMessage, QString("Позиция %1: ожидалась ')'").arg(in.position()));
+        }
+        elements.push_back(element);
+    } while (in.accept(';'));
+
+    if (braced && !in.accept('}')) {
+        return fail(errorMessage, QString("Позиция %1: ожидалась '}'").arg(in.position()));
+    }
+    if (!in.atEnd()) {
+        return fail(errorMessage, QString("Позиция %1: лишние символы после описания теста").arg(in.position()));
+    }
+    if (elements.empty()) {
+        return fail(errorMessage, "Тест не содержит ни одного элемента");
+    }
+    return true;
+}
+
+QString MarchParser::formatElement(const MarchElement& e) {
+    if (e.isDelay()) {
+        return e.delay == DEFAULT_DELAY_TICKS ? QString("Del") : QString("Del(%1)").arg(e.delay);
+    }
+    QString order = (e.order == AddressOrder::Up) ? "⇑" : (e.order == AddressOrder::Down) ? "⇓" : "⇕";
+    QStringList ops;
+    for (const auto& op : e.ops) {
+        ops << QString("%1%2").arg(op.write ? 'w' : 'r').arg(op.inverted ? '1' : '0');
+    }
+    return QString("%1(%2)").arg(order).arg(ops.join(","));
+}
+
+QString MarchParser::format(const std::vector<MarchElement>& elements) {
+    QStringList parts;
+    for (const auto& e : elements) {
+        parts << formatElement(e);
+    }
+    return QString("{%1}").arg(parts.join("; "));
+}
+
+const std::vector<MarchAlgorithm>& MarchLibrary::algorithms() {
+    static const std::vector<MarchAlgorithm> library = []() {
+        std::vector<MarchAlgorithm> list;
+        for (const auto& b : BUILTIN_ALGORITHMS) {
+            MarchAlgorithm algo;
+            QString error;
+            // Built-in notations are fixed, a parse failure is a programming error
+            bool ok = compile(QString::fromUtf8(b.name), QString::fromUtf8(b.notation), b.background, algo, &error);
+            Q_ASSERT_X(ok, "MarchLibrary", qPrintable(error));
+            Q_UNUSED(ok);
+            algo.id = QString::fromLatin1(b.id);
+            algo.description = QString::fromUtf8(b.description);
+            list.push_back(algo);
+        }
+        return list;
+    }();
+    return library;
+}
+
+const MarchAlgorithm* MarchLibrary::find(const QString& id) {
+    for (const auto& algo : algorithms()) {
+        if (algo.id == id) return &algo;
+    }
+    return nullptr;
+}
+
+bool MarchLibrary::compile(const QString& name, const QString& notation, DataBackground background,
+                           MarchAlgorithm& algorithm, QString* errorMessage) {
+    std::vector<MarchElement> elements;
+    if (!MarchParser::parse(notation, elements, errorMessage)) return false;
+    algorithm = MarchAlgorithm();
+    algorithm.id = "custom";
+    algorithm.name = name;
+    algorithm.notation = MarchParser::format(elements);
+    algorithm.background = background;
+    algorithm.elements = elements;
+    return true;
+}
@@ -0,0 +1,77 @@
+#ifndef MARCHTEST_H
+#define MARCHTEST_H
+
+#include <QString>
+#include <QMetaType>
+#include <vector>
+#include "types.h"
+
+// Порядок перебора адресов в элементе марш-теста
+enum class AddressOrder {
+    Up,    // ⇑ — по возрастанию
+    Down,  // ⇓ — по убыванию
+    Any    // ⇕ — порядок не важен (выполняется по возрастанию)
+};
+
+// Фоновый шаблон данных D(addr). В нотации "0" означает D(addr), "1" — ~D(addr),
+// поэтому одна и та же запись подходит и для сплошных, и для шагающих шаблонов.
+enum class DataBackground {
+    Solid,         // D = 0x00000000
+    WalkingOnes,   // D = 1 << (addr % 32)
+    WalkingZeros   // D = ~(1 << (addr % 32))
+};
+
+// Одна операция: r0, r1, w0 или w1
+struct MarchOp {
+    bool write = false;
+    bool inverted = false; // false — "0" (фон), true — "1" (инверсия фона)
+};
+
+// Элемент марш-теста: порядок адресов и операции, выполняемые над каждой ячейкой.
+// Элемент задержки (Del) не содержит операций и продвигает модельное время на delay тактов.
+struct MarchElement {
+    AddressOrder order = AddressOrder::Up;
+    std::vector<MarchOp> ops;
+    quint64 delay = 0;
+
+    bool isDelay() const { return delay > 0; }
+};
+
+// Скомпилированный алгоритм тестирования
+struct MarchAlgorithm {
+    QString id;
+    QString name;
+    QString notation;
+    QString description;
+    DataBackground background = DataBackground::Solid;
+    std::vector<MarchElement> elements;
+
+    size_t opsPerWord() const;   // Complexity: total operations per address ("10n" → 10)
+    size_t readsPerWord() const;
+};
+
+// Parser for march notation, e.g. "{⇕(w0); ⇑(r0,w1); ⇓(r1,w0); ⇕(r0)}".
+// Address orders: ⇑ ↑ up, ⇓ ↓ down, ⇕ ↕ any. Operations: r0, r1, w0, w1.
+// "Del" or "Del(N)" is a delay element of DEFAULT_DELAY_TICKS (N) ticks of the simulated clock.
+// Braces are optional; elements are separated by ';'.
+class MarchParser {
+public:
+    static bool parse(const QString& notation, std::vector<MarchElement>& elements, QString* errorMessage = nullptr);
+    static QString format(const std::vector<MarchElement>& elements);
+    static QString formatElement(const MarchElement& element); // "⇑(r0,w1)"
+};
+
+// Built-in algorithms. Adding one is a single entry in the table in marchtest.cpp.
+class MarchLibrary {
+public:
+    static const std::vector<MarchAlgorithm>& algorithms();
+    static const MarchAlgorithm* find(const QString& id);
+
+    // Compiles a user-supplied notation into an algorithm
+    static bool compile(const QString& name, const QString& notation, DataBackground background,
+                        MarchAlgorithm& algorithm, QString* errorMessage = nullptr);
+};
+
+Q_DECLARE_METATYPE(MarchAlgorithm)
+
+#endif // MARCHTEST_H
@@ -0,0 +1,295 @@
+#include "memorymodel.h"
+#include "constants.h"
+
+namespace {
+
+// Storage view handed to write-path faults
+class StorageCells : public FaultCellAccess {
+public:
+    StorageCells(MemoryStorage& storage, size_t& changedBegin, size_t& changedEnd)
+        : _storage(storage), _changedBegin(changedBegin), _changedEnd(changedEnd), _failedAddr(0), _failed(false) {}
+
+    Word load(size_t addr) const override {
+        return addr < _storage.size() ? _storage.load(addr) : 0u;
+    }
+    void store(size_t addr, Word value) override {
+        if (addr >= _storage.size()) return; // Faults are clipped to the layout they were injected for
+        if (!_storage.store(addr, value)) {
+            if (!_failed) _failedAddr = addr;
+            _failed = true;
+            return;
+        }
+        _changedBegin = std::min(_changedBegin, addr);
+        _changedEnd = std::max(_changedEnd, addr + 1);
+    }
+
+    bool failed() const { return _failed; }
+    size_t failedAddr() const { return _failedAddr; }
+
+private:
+    MemoryStorage& _storage;
+    size_t& _changedBegin;
+    size_t& _changedEnd;
+    size_t _failedAddr;
+    bool _failed;
+};
+
+} // namespace
+
+MemoryModel::MemoryModel(size_t words, QObject* parent)
+    : QObject(parent), _storage(words), _faultInjector(new FaultInjector()) {
+    _faultInjector->setTopology(MemoryTopology(words, DEFAULT_TOPOLOGY_COLUMNS, AddressScramble::None));
+}
+
+MemoryModel::~MemoryModel() = default;
+
+size_t MemoryModel::size() const {
+    QReadLocker locker(&_lock);
+    return _storage.size();
+}
+
+size_t MemoryModel::allocatedBytes() const {
+    QReadLocker locker(&_lock);
+    return _storage.allocatedBytes();
+}
+
+void MemoryModel::reset() {
+    size_t size;
+    {
+        QWriteLocker locker(&_lock);
+        _storage.clear(); // Released chunks read back as zeros
+        size = _storage.size(); // Save size while lock is held
+    } // Lock automatically released here
+    _faultInjector->reset();
+    emit faultsChanged();
+    emit dataChanged(0, size);
+}
+
+bool MemoryModel::resize(size_t words) {
+    if (words == 0 || words > MAX_MEMORY_SIZE) {
+        emit errorOccurred(QString("MemoryModel::resize: Size %1 is out of range (1-%2)")
+                          .arg(words).arg(MAX_MEMORY_SIZE));
+        return false;
+    }
+    {
+        QWriteLocker locker(&_lock);
+        _storage.resize(words);
+    }
+    // Fault ranges refer to the old layout - drop them
+    _faultInjector->reset();
+    std::shared_ptr<const MemoryTopology> topology = _faultInjector->topology();
+    _faultInjector->setTopology(MemoryTopology(words, topology->columns(), topology->scramble()));
+    emit faultsChanged();
+    emit sizeChanged(words);
+    emit dataChanged(0, words);
+    return true;
+}
+
+Word MemoryModel::read(size_t addr) {
+    Word stored_value;
+    {
+        QReadLocker locker(&_lock);
+        if (addr >= _storage.size()) {
+            // Out of bounds - emit error signal and return 0 for backward compatibility
+            emit errorOccurred(QString("MemoryModel::read: Address %1 is out of bounds (size: %2)")
+                              .arg(addr).arg(_storage.size()));
+            return 0u;
+        }
+        stored_value = _storage.load(addr); // Always read the actual stored value
+    } // Lock automatically released here
+    Word value = _faultInjector->applyFault(addr, stored_value);
+    if (_faultInjector->remapsReads(addr, addr + 1)) applyDecoder(addr, &value, 1, _faultInjector->readPass());
+    return value;
+}
+
+void MemoryModel::applyDecoder(size_t begin, Word* words, size_t count, quint32 pass) {
+    QReadLocker locker(&_lock);
+    if (begin > _storage.size() || count > _storage.size() - begin) return; // Resized meanwhile
+    size_t unusedBegin = begin, unusedEnd = begin;
+    const StorageCells cells(_storage, unusedBegin, unusedEnd);
+    _faultInjector->applyDecoderRange(begin, words, count, pass, cells);
+}
+
+bool MemoryModel::storeThroughFaults(size_t addr, Word value, size_t& changedBegin, size_t& changedEnd,
+                               const char* caller) {
+    StorageCells cells(_storage, changedBegin, changedEnd);
+    _faultInjector->applyWrite(addr, value, cells);
+    if (cells.failed()) {
+        emit errorOccurred(QString("MemoryModel::%1: Not enough memory to back address %2")
+                          .arg(caller).arg(cells.failedAddr()));
+        return false;
+    }
+    return true;
+}
+
+bool MemoryModel::storeWord(size_t addr, Word value, size_t& changedBegin, size_t& changedEnd,
+                            const char* caller) {
+    QReadLocker locker(&_lock);
+    if (addr >= _storage.size()) {
+        // Out of bounds - emit error signal and return
+        emit errorOccurred(QString("MemoryModel::%1: Address %2 is out of bounds (size: %3)")
+                          .arg(caller).arg(addr).arg(_storage.size()));
+        return false;
+    }
+    changedBegin = addr;
+    changedEnd = addr + 1;
+    if (_faultInjector->affectsWrites(addr, addr + 1)) {
+        return storeThroughFaults(addr, value, changedBegin, changedEnd, caller);
+    }
+    if (!_storage.store(addr, value)) {
+        emit errorOccurred(QString("MemoryModel::%1: Not enough memory to back address %2")
+                          .arg(caller).arg(addr));
+        return false;
+    }
+    return true;
+}
+
+void MemoryModel::write(size_t addr, Word value) {
+    // WRITE ALWAYS STORES EXACT VALUE (read faults are not applied during write;
+    // coupling faults may still disturb their victims)
+    size_t changedBegin, changedEnd;
+    if (storeWord(addr, value, changedBegin, changedEnd, "write")) {
+        emit dataChanged(changedBegin, changedEnd);
+    }
+}
+
+void MemoryModel::writeDirect(size_t addr, Word value) {
+    size_t changedBegin, changedEnd;
+    if (storeWord(addr, value, changedBegin, changedEnd, "writeDirect")) {
+        emit dataChanged(changedBegin, changedEnd);
+    }
+}
+
+bool MemoryModel::checkRange(size_t begin, size_t count, const char* caller) {
+    // Caller holds _lock
+    if (begin > _storage.size() || count > _storage.size() - begin) {
+        emit errorOccurred(QString("MemoryModel::%1: Range [%2, %3) is out of bounds (size: %4)")
+                          .arg(caller).arg(begin).arg(begin + count).arg(_storage.size()));
+        return false;
+    }
+    return true;
+}
+
+bool MemoryModel::readRange(size_t begin, Word* out, size_t count) {
+    return readRange(begin, out, count, _faultInjector->readPass());
+}
+
+bool MemoryModel::readRange(size_t begin, Word* out, size_t count, quint32 pass, MemoryAccessStats* stats) {
+    {
+        lockForAccess(stats);
+        AccessUnlocker unlocker(&_lock);
+        if (!checkRange(begin, count, "readRange")) return false;
+        _storage.loadRange(begin, out, count);
+    }
+    size_t applications = _faultInjector->applyFaultRange(begin, out, count, pass);
+    if (_faultInjector->remapsReads(begin, begin + count)) applyDecoder(begin, out, count, pass);
+    if (stats) stats->fault_applications += applications;
+    return true;
+}
+
+bool MemoryModel::writeRange(size_t begin, const Word* data, size_t count) {
+    size_t changedBegin = begin;
+    size_t changedEnd = begin + count;
+    {
+        QReadLocker locker(&_lock);
+        if (!checkRange(begin, count, "writeRange")) return false;
+        if (_faultInjector->affectsWrites(begin, begin + count)) {
+            for (size_t i = 0; i < count; ++i) {
+                if (!storeThroughFaults(begin + i, data[i], changedBegin, changedEnd, "writeRange")) return false;
+            }
+        } else if (!_storage.storeRange(begin, data, count)) {
+            emit errorOccurred(QString("MemoryModel::writeRange: Not enough memory to back range starting at %1")
+                              .arg(begin));
+            return false;
+        }
+    }
+    if (count > 0) emit dataChanged(changedBegin, changedEnd);
+    return true;
+}
+
+bool MemoryModel::setTopology(size_t columns, AddressScramble scramble) {
+    if (!MemoryTopology::isValidColumns(columns)) {
+        emit errorOccurred(QString("MemoryModel::setTopology: Column count %1 is not a power of two in 1-%2")
+                          .arg(columns).arg(MAX_TOPOLOGY_COLUMNS));
+        return false;
+    }
+    size_t words = size();
+    _faultInjector->setTopology(MemoryTopology(words, columns, scramble));
+    // Neighborhood faults now see other neighbors
+    emit faultsChanged();
+    emit dataChanged(0, words);
+    return true;
+}
+
+std::shared_ptr<const MemoryTopology> MemoryModel::topology() const {
+    return _faultInjector->topology();
+}
+
+bool MemoryModel::injectFault(const InjectedFault& f) {
+    size_t size;
+    {
+        QReadLocker locker(&_lock);
+        size = _storage.size(); // Read size while lock is held
+    }
+    if (!_faultInjector->injectFault(f)) {
+        emit errorOccurred(QString("MemoryModel::injectFault: At most %1 faults can be injected").arg(MAX_FAULTS));
+        return false;
+    }
+    emit faultInjected();
+    emit faultsChanged();
+    emit dataChanged(0, size);
+    return true;
+}
+
+bool MemoryModel::removeFault(size_t index) {
+    if (!_faultInjector->removeFault(index)) {
+        emit errorOccurred(QString("MemoryModel::removeFault: No fault with index %1").arg(index));
+        return false;
+    }
+    emit faultsChanged();
+    emit dataChanged(0, size());
+    return true;
+}
+
+void MemoryModel::clearFaults() {
+    _faultInjector->reset();
+    emit faultsChanged();
+    emit dataChanged(0, size());
+}
+
+std::vector<InjectedFault> MemoryModel::faults() const {
+    return _faultInjector->faults();
+}
+
+std::shared_ptr<const FaultSnapshot> MemoryModel::faultSnapshot() const {
+    return _faultInjector->snapshot();
+}
+
+bool MemoryModel::isAddrFaulty(size_t addr) const {
+    return _faultInjector->isAddrFaulty(addr);
+}
+
+void MemoryModel::setReadPass(quint32 pass) {
+    _faultInjector->setReadPass(pass);
+}
+
+void MemoryModel::advanceClock(quint64 ticks) {
+    _faultInjector->advanceClock(ticks);
+    // Retention-faulty cells may have decayed: their reads change without a write
+    std::shared_ptr<const FaultSnapshot> snap = _faultInjector->snapshot();
+    const size_t words = size();
+    for (const InjectedFault& f : snap->faults.faults()) {
+        if (f.model == FaultModel::Retention && f.addr < words) {
+            emit dataChanged(f.addr, f.addr + std::min(f.len, words - f.addr));
+        }
+    }
+}
+
+quint64 MemoryModel::clock() const {
+    return _faultInjector->clock();
+}
+
+InjectedFault MemoryModel::currentFault() const {
+    // currentFault() is thread-safe (reads the published fault snapshot)
+    return _faultInjector->currentFault();
+}
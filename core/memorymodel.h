@@ -0,0 +1,143 @@
+#ifndef MEMORYMODEL_H
+#define MEMORYMODEL_H
+
+#include <QObject>
+#include <memory>
+#include <algorithm>
+#include <QReadWriteLock>
+#include <QElapsedTimer>
+#include "types.h"
+#include "memorystorage.h"
+#include "faultinjector.h"
+
+// Optional per-caller counters for the bulk API (used by the tester's phase metrics).
+// Each worker passes its own instance, so no synchronisation is needed.
+struct MemoryAccessStats {
+    quint64 lock_waits = 0;          // Accesses that found the layout lock taken
+    qint64 lock_wait_ns = 0;         // Time spent waiting for it
+    quint64 fault_applications = 0;  // Faulty words read (once per covering fault)
+};
+
+class MemoryModel : public QObject {
+Q_OBJECT
+public:
+explicit MemoryModel(size_t words = 256, QObject* parent = nullptr);
+~MemoryModel() override;
+
+size_t size() const;
+void reset();
+// Changes the number of words at runtime. Contents and faults are discarded.
+bool resize(size_t words);
+size_t allocatedBytes() const;
+
+// thread-safe read/write
+Word read(size_t addr);
+void write(size_t addr, Word value);
+void writeDirect(size_t addr, Word value);
+
+// Bulk access: the lock is taken once per call and a single coalesced
+// dataChanged(begin, begin + count) is emitted for writes.
+bool readRange(size_t begin, Word* out, size_t count);
+// Same with an explicit fault RNG pass instead of the one set by setReadPass()
+bool readRange(size_t begin, Word* out, size_t count, quint32 pass, MemoryAccessStats* stats = nullptr);
+bool writeRange(size_t begin, const Word* data, size_t count);
+// Writes generator(addr) to every address of the range; generator is any callable Word(size_t)
+template <typename Generator>
+bool fillPattern(size_t begin, size_t count, Generator generator, MemoryAccessStats* stats = nullptr);
+
+// Physical rows x columns layout used by neighborhood faults (see MemoryTopology).
+// Faults are kept; resize() keeps the columns and the scramble.
+bool setTopology(size_t columns, AddressScramble scramble);
+std::shared_ptr<const MemoryTopology> topology() const;
+
+// Faults accumulate: every injection adds one more fault to the set (up to MAX_FAULTS)
+bool injectFault(const InjectedFault& f);
+bool removeFault(size_t index);
+void clearFaults();
+std::vector<InjectedFault> faults() const;
+std::shared_ptr<const FaultSnapshot> faultSnapshot() const;
+bool isAddrFaulty(size_t addr) const;
+InjectedFault currentFault() const;
+// Read pass used as part of the fault RNG counter (see FaultInjector::setReadPass)
+void setReadPass(quint32 pass);
+// Simulated clock of retention faults (see FaultInjector::advanceClock); reset() zeroes it
+void advanceClock(quint64 ticks);
+quint64 clock() const;
+
+signals:
+void dataChanged(size_t begin, size_t end);
+void sizeChanged(size_t words);
+void faultInjected();
+void faultsChanged();
+void errorOccurred(const QString& message);
+
+private:
+// Read-locks _lock; with stats, a contended acquisition is counted and timed
+void lockForAccess(MemoryAccessStats* stats) const {
+    if (!stats) {
+        _lock.lockForRead();
+        return;
+    }
+    if (_lock.tryLockForRead()) return;
+    QElapsedTimer wait;
+    wait.start();
+    _lock.lockForRead();
+    ++stats->lock_waits;
+    stats->lock_wait_ns += wait.nsecsElapsed();
+}
+struct AccessUnlocker {
+    explicit AccessUnlocker(QReadWriteLock* lock) : _lock(lock) {}
+    ~AccessUnlocker() { _lock->unlock(); }
+    QReadWriteLock* _lock;
+};
+bool checkRange(size_t begin, size_t count, const char* caller);
+// Redoes the reads of decoder-faulty addresses in [begin, begin + count) through the remap table
+void applyDecoder(size_t begin, Word* words, size_t count, quint32 pass);
+bool storeWord(size_t addr, Word value, size_t& changedBegin, size_t& changedEnd, const char* caller);
+// Caller holds _lock. Write through the write-path faults; [changedBegin, changedEnd)
+// grows to cover every cell the write changed (victims and remap targets may lie outside
+// the written range).
+bool storeThroughFaults(size_t addr, Word value, size_t& changedBegin, size_t& changedEnd, const char* caller);
+
+// Read-locked by every access, write-locked by resize/reset (which change the layout).
+// Word accesses themselves go straight to the lock-free chunked storage.
+mutable QReadWriteLock _lock;
+MemoryStorage _storage;
+std::unique_ptr<FaultInjector> _faultInjector;
+};
+
+template <typename Generator>
+bool MemoryModel::fillPattern(size_t begin, size_t count, Generator generator, MemoryAccessStats* stats) {
+    size_t changedBegin = begin;
+    size_t changedEnd = begin + count;
+    {
+        lockForAccess(stats);
+        AccessUnlocker unlocker(&_lock);
+        if (!checkRange(begin, count, "fillPattern")) return false;
+        size_t addr = begin;
+        size_t end = begin + count;
+        if (_faultInjector->affectsWrites(begin, end)) {
+            // Slow path: every word goes through the write-path faults, in address order
+            for (; addr < end; ++addr) {
+                if (!storeThroughFaults(addr, generator(addr), changedBegin, changedEnd, "fillPattern")) return false;
+            }
+        }
+        while (addr < end) {
+            size_t available = 0;
+            Word* dst = _storage.mutableSpan(addr, available);
+            if (!dst) {
+                emit errorOccurred(QString("MemoryModel::fillPattern: Not enough memory to back address %1").arg(addr));
+                return false;
+            }
+            size_t n = std::min(available, end - addr);
+            for (size_t i = 0; i < n; ++i) {
+                dst[i] = generator(addr + i);
+            }
+            addr += n;
+        }
+    }
+    if (count > 0) emit dataChanged(changedBegin, changedEnd);
+    return true;
+}
+
+#endif // MEMORYMODEL_H
@@ -0,0 +1,136 @@
+#include "memorystorage.h"
+#include <QtGlobal>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#if defined(Q_OS_WIN)
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace {
+
+void* alignedAlloc(size_t bytes, size_t alignment) {
+#if defined(Q_OS_WIN)
+    return _aligned_malloc(bytes, alignment);
+#else
+    void* p = nullptr;
+    if (posix_memalign(&p, alignment, bytes) != 0) {
+        return nullptr;
+    }
+    return p;
+#endif
+}
+
+void alignedFree(void* p) {
+#if defined(Q_OS_WIN)
+    _aligned_free(p);
+#else
+    free(p);
+#endif
+}
+
+} // namespace
+
+MemoryStorage::MemoryStorage(size_t words)
+    : _size(0), _chunkCount(0) {
+    resize(words);
+}
+
+MemoryStorage::~MemoryStorage() {
+    releaseChunks();
+}
+
+size_t MemoryStorage::chunkWords(size_t chunkIndex) const {
+    size_t base = chunkIndex << MEMORY_CHUNK_SHIFT;
+    size_t remaining = _size - base;
+    return remaining < MEMORY_CHUNK_WORDS ? remaining : MEMORY_CHUNK_WORDS;
+}
+
+size_t MemoryStorage::allocatedBytes() const {
+    size_t bytes = 0;
+    for (size_t i = 0; i < _chunkCount; ++i) {
+        if (_chunks[i].load(std::memory_order_relaxed)) {
+            bytes += chunkWords(i) * sizeof(Word);
+        }
+    }
+    return bytes;
+}
+
+void MemoryStorage::resize(size_t words) {
+    releaseChunks();
+    _size = words;
+    _chunkCount = (words + MEMORY_CHUNK_WORDS - 1) >> MEMORY_CHUNK_SHIFT;
+    // At least one slot so that load()/store() never index an empty array
+    size_t slotCount = _chunkCount > 0 ? _chunkCount : 1;
+    _chunks.reset(new std::atomic<Word*>[slotCount]);
+    for (size_t i = 0; i < slotCount; ++i) {
+        _chunks[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+void MemoryStorage::clear() {
+    for (size_t i = 0; i < _chunkCount; ++i) {
+        Word* chunk = _chunks[i].exchange(nullptr, std::memory_order_acq_rel);
+        if (chunk) alignedFree(chunk);
+    }
+}
+
+void MemoryStorage::releaseChunks() {
+    if (_chunks) clear();
+}
+
+void MemoryStorage::loadRange(size_t begin, Word* out, size_t count) const {
+    while (count > 0) {
+        size_t available = 0;
+        const Word* src = span(begin, available);
+        size_t n = available < count ? available : count;
+        if (src) {
+            std::memcpy(out, src, n * sizeof(Word));
+        } else {
+            std::memset(out, 0, n * sizeof(Word));
+        }
+        out += n;
+        begin += n;
+        count -= n;
+    }
+}
+
+bool MemoryStorage::storeRange(size_t begin, const Word* data, size_t count) {
+    while (count > 0) {
+        size_t available = 0;
+        Word* dst = mutableSpan(begin, available);
+        if (!dst) return false;
+        size_t n = available < count ? available : count;
+        std::memcpy(dst, data, n * sizeof(Word));
+        data += n;
+        begin += n;
+        count -= n;
+    }
+    return true;
+}
+
+Word* MemoryStorage::allocateChunk(size_t chunkIndex) {
+    size_t words = chunkWords(chunkIndex);
+    size_t bytes = words * sizeof(Word);
+    // Full chunks are aligned to the huge page size so the kernel can back them with
+    // transparent huge pages; the short tail chunk only needs cache-line alignment
+    size_t alignment = (words == MEMORY_CHUNK_WORDS) ? HUGE_PAGE_SIZE : CACHE_LINE_SIZE;
+    Word* chunk = static_cast<Word*>(alignedAlloc(bytes, alignment));
+    if (!chunk) return nullptr;
+#if defined(Q_OS_LINUX) && defined(MADV_HUGEPAGE)
+    if (words == MEMORY_CHUNK_WORDS) {
+        madvise(chunk, bytes, MADV_HUGEPAGE);
+    }
+#endif
+    std::memset(chunk, 0, bytes);
+
+    // Another thread may have allocated the same chunk concurrently - keep the winner
+    Word* expected = nullptr;
+    if (!_chunks[chunkIndex].compare_exchange_strong(expected, chunk, std::memory_order_acq_rel)) {
+        alignedFree(chunk);
+        return expected;
+    }
+    return chunk;
+}
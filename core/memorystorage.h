@@ -0,0 +1,82 @@
+#ifndef MEMORYSTORAGE_H
+#define MEMORYSTORAGE_H
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include "types.h"
+#include "constants.h"
+
+// Chunked backing store for the simulated memory array.
+// Chunks are allocated lazily on first write and aligned to huge-page boundaries,
+// so untouched regions cost no RAM and read back as zeros. Multi-gigabyte arrays
+// are therefore cheap to create and to reset.
+//
+// Thread safety: load()/store() may be called concurrently from several threads
+// (chunk allocation is lock-free). resize()/clear() must be externally serialized
+// against all other calls (MemoryModel does this with its layout lock).
+class MemoryStorage {
+public:
+    explicit MemoryStorage(size_t words = 0);
+    ~MemoryStorage();
+
+    MemoryStorage(const MemoryStorage&) = delete;
+    MemoryStorage& operator=(const MemoryStorage&) = delete;
+
+    size_t size() const { return _size; }
+    size_t allocatedBytes() const;
+
+    // Changes the number of words; all contents are discarded
+    void resize(size_t words);
+    // Releases all chunks - the whole array reads as zeros afterwards
+    void clear();
+
+    Word load(size_t addr) const {
+        const Word* chunk = _chunks[addr >> MEMORY_CHUNK_SHIFT].load(std::memory_order_acquire);
+        return chunk ? chunk[addr & MEMORY_CHUNK_MASK] : 0u;
+    }
+
+    // Returns false if the backing chunk could not be allocated
+    bool store(size_t addr, Word value) {
+        Word* chunk = _chunks[addr >> MEMORY_CHUNK_SHIFT].load(std::memory_order_acquire);
+        if (!chunk) {
+            chunk = allocateChunk(addr >> MEMORY_CHUNK_SHIFT);
+            if (!chunk) return false;
+        }
+        chunk[addr & MEMORY_CHUNK_MASK] = value;
+        return true;
+    }
+
+    // Contiguous view of [addr, addr + available) within one chunk, where available is
+    // limited by the chunk end. Returns nullptr for a never-written chunk (reads as zeros).
+    const Word* span(size_t addr, size_t& available) const {
+        available = chunkWords(addr >> MEMORY_CHUNK_SHIFT) - (addr & MEMORY_CHUNK_MASK);
+        const Word* chunk = _chunks[addr >> MEMORY_CHUNK_SHIFT].load(std::memory_order_acquire);
+        return chunk ? chunk + (addr & MEMORY_CHUNK_MASK) : nullptr;
+    }
+    // Writable variant; allocates the chunk if needed. Returns nullptr on allocation failure.
+    Word* mutableSpan(size_t addr, size_t& available) {
+        available = chunkWords(addr >> MEMORY_CHUNK_SHIFT) - (addr & MEMORY_CHUNK_MASK);
+        Word* chunk = _chunks[addr >> MEMORY_CHUNK_SHIFT].load(std::memory_order_acquire);
+        if (!chunk) {
+            chunk = allocateChunk(addr >> MEMORY_CHUNK_SHIFT);
+            if (!chunk) return nullptr;
+        }
+        return chunk + (addr & MEMORY_CHUNK_MASK);
+    }
+
+    // Bulk copies; the caller guarantees [begin, begin + count) is in bounds
+    void loadRange(size_t begin, Word* out, size_t count) const;
+    bool storeRange(size_t begin, const Word* data, size_t count);
+
+private:
+    Word* allocateChunk(size_t chunkIndex);
+    size_t chunkWords(size_t chunkIndex) const;
+    void releaseChunks();
+
+    size_t _size;
+    size_t _chunkCount;
+    std::unique_ptr<std::atomic<Word*>[]> _chunks;
+};
+
+#endif // MEMORYSTORAGE_H
@@ -0,0 +1,279 @@
+#include "memorytester.h"
+#include "constants.h"
+#include <QThread>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Data backgrounds D(addr); "1" operations use D(addr) ^ ~0.
+// Every background repeats every BITS_PER_WORD addresses (CompareKernel::PERIOD).
+struct SolidBackground {
+    Word operator()(size_t) const { return 0u; }
+};
+
+struct WalkingOnesBackground {
+    Word operator()(size_t a) const { return 1u << (a % BITS_PER_WORD); }
+};
+
+struct WalkingZerosBackground {
+    Word operator()(size_t a) const { return ~(1u << (a % BITS_PER_WORD)); }
+};
+
+template <typename Background>
+struct OpPattern {
+    OpPattern(Background b, Word m) : background(b), invert(m) {}
+    Word operator()(size_t a) const { return background(a) ^ invert; }
+    Background background;
+    Word invert;
+};
+
+template <typename Background>
+OpPattern<Background> opPattern(Background background, const MarchOp& op) {
+    return OpPattern<Background>(background, op.inverted ? ~0u : 0u);
+}
+
+} // namespace
+
+MemoryTester::MemoryTester(MemoryModel* mem, QObject* parent)
+    : QObject(parent), _mem(mem), _control(nullptr), _progress(nullptr), _mode(TestExecutionMode::Visual),
+      _blockWords(PROGRESS_UPDATE_INTERVAL) {}
+
+template <typename Background>
+void MemoryTester::runElements(const MarchAlgorithm& algo, size_t n, Background background) {
+    const size_t blocks = (n + _blockWords - 1) / _blockWords;
+    const bool parallel = _executor.threadCount() > 1;
+    quint32 passBase = 0;
+    for (const MarchElement& element : algo.elements) {
+        if (element.isDelay()) {
+            // Simulated time passes without touching the array: retention faults decay lazily
+            if (cancelled()) {
+                _results->setCancelled();
+                return;
+            }
+            _counters.assign(size_t(_executor.threadCount()), WorkerCounters());
+            TraceScope delayScope("delay", "test");
+            _mem->advanceClock(element.delay);
+            _results->addPhase(collectPhase(element, 0));
+            continue;
+        }
+        // Elements are separated by a barrier (forEach returns when all partitions are done).
+        // Within an element cell faults act on single cells, so partitions are independent;
+        // partitions are handed out in element order (descending for ⇓).
+        // Coupling and decoder faults link cells across partitions: runs with them are serial.
+        if (parallel) {
+            _blockFailures.assign(blocks, std::vector<TestFailure>());
+        }
+        _blockDone.assign(blocks, 0);
+        _counters.assign(size_t(_executor.threadCount()), WorkerCounters());
+        QElapsedTimer phaseTimer;
+        phaseTimer.start();
+        TraceScope phaseScope("element", "test");
+        if (phaseScope.active()) phaseScope.setDetail(MarchParser::formatElement(element));
+        // Progress is polled by the observer; only the animation needs a hook between blocks
+        ParallelExecutor::Poll pace;
+        if (_mode == TestExecutionMode::Visual) pace = [this]() { paceVisualization(); };
+        _executor.forEach(blocks, [&](size_t index, int worker) {
+            size_t block = (element.order == AddressOrder::Down) ? blocks - 1 - index : index;
+            runBlock(element, block, n, passBase, background, worker, parallel ? _blockFailures[block] : _failures);
+        }, pace);
+        _results->addPhase(collectPhase(element, phaseTimer.nsecsElapsed()));
+
+        if (parallel) {
+            // Merge in the order a serial run would have produced
+            for (size_t index = 0; index < blocks; ++index) {
+                size_t block = (element.order == AddressOrder::Down) ? blocks - 1 - index : index;
+                _results->addFailures(_blockFailures[block]);
+            }
+        } else {
+            _results->addFailures(_failures);
+        }
+
+        quint32 reads = 0;
+        for (const MarchOp& op : element.ops) {
+            if (!op.write) ++reads;
+        }
+        if (cancelled()) {
+            // Partial element: only the blocks that ran count as tested
+            if (reads > 0) {
+                for (size_t block = 0; block < blocks; ++block) {
+                    if (!_blockDone[block]) continue;
+                    size_t begin = block * _blockWords;
+                    size_t count = std::min(_blockWords, n - begin);
+                    _results->markTested(begin, count);
+                    _results->addReads(quint64(count) * reads);
+                }
+            }
+            _results->setCancelled();
+            return;
+        }
+        if (reads > 0) {
+            _results->markTested(0, n);
+            _results->addReads(quint64(n) * reads);
+        }
+        passBase += reads;
+        _mem->advanceClock(1); // One sweep over the array is one tick of the simulated clock
+    }
+}
+
+template <typename Background>
+void MemoryTester::runBlock(const MarchElement& element, size_t block, size_t n, quint32 passBase,
+                            Background background, int worker, std::vector<TestFailure>& failures) {
+    // A block either runs completely or not at all, so partial results stay consistent
+    if (!checkpoint()) return;
+    TraceScope scope("block", "worker");
+    if (scope.active()) scope.setDetail(QString::number(block));
+    size_t begin = block * _blockWords;
+    size_t count = std::min(_blockWords, n - begin);
+    size_t end = begin + count;
+    std::pair<const size_t*, const size_t*> linked(nullptr, nullptr);
+    if (_faults) linked = _faults->faults.linkedCellsIn(begin, end);
+    if (linked.first == linked.second) {
+        runOps(element, begin, count, n, passBase, background, worker, failures);
+    } else if (element.order != AddressOrder::Down) {
+        // Linked cells interact, so each of them gets the whole element on its own,
+        // in address order; the runs between them are still processed in bulk
+        size_t addr = begin;
+        for (const size_t* cell = linked.first; cell != linked.second; ++cell) {
+            runOps(element, addr, *cell - addr, n, passBase, background, worker, failures);
+            runOps(element, *cell, 1, n, passBase, background, worker, failures);
+            addr = *cell + 1;
+        }
+        runOps(element, addr, end - addr, n, passBase, background, worker, failures);
+    } else {
+        size_t addr = end;
+        for (const size_t* cell = linked.second; cell != linked.first;) {
+            --cell;
+            runOps(element, *cell + 1, addr - *cell - 1, n, passBase, background, worker, failures);
+            runOps(element, *cell, 1, n, passBase, background, worker, failures);
+            addr = *cell;
+        }
+        runOps(element, begin, addr - begin, n, passBase, background, worker, failures);
+    }
+    _counters[worker].words += count;
+    if (_progress) _progress->addDone(quint64(count) * element.ops.size());
+    _blockDone[block] = 1;
+}
+
+template <typename Background>
+void MemoryTester::runOps(const MarchElement& element, size_t begin, size_t count, size_t n, quint32 passBase,
+                          Background background, int worker, std::vector<TestFailure>& failures) {
+    if (count == 0) return;
+    // Operations are applied to the whole run in turn. Outside linked cells faults
+    // act on single cells, so this is equivalent to applying the sequence word by word.
+    // Every read operation of the element is its own read pass:
+    // fault outcomes depend on (seed, address, pass) only
+    quint32 pass = passBase;
+    WorkerCounters& counters = _counters[worker];
+    for (const MarchOp& op : element.ops) {
+        if (op.write) {
+            _mem->fillPattern(begin, count, opPattern(background, op), &counters.access);
+            counters.writes += count;
+        } else {
+            verifyBlock(begin, count, n, background, op.inverted ? ~0u : 0u, ++pass, worker, failures);
+            counters.reads += count;
+        }
+    }
+}
+
+template <typename Background>
+void MemoryTester::verifyBlock(size_t begin, size_t count, size_t n, Background background, Word invert, quint32 pass,
+                               int worker, std::vector<TestFailure>& failures) {
+    OpPattern<Background> expected(background, invert);
+    Word* buffer = _buffers[worker].data();
+    // Faults are applied here, on the read path
+    if (!_mem->readRange(begin, buffer, count, pass, &_counters[worker].access)) return;
+    // Only mismatches are stored; passing reads are accounted for per element
+    const CompareKernel::Pattern pattern = CompareKernel::pattern(expected);
+    quint64* mismatches = _masks[worker].data();
+    if (CompareKernel::compare(buffer, count, begin, pattern, mismatches) > 0) {
+        CompareKernel::forEachMismatch(mismatches, count, [&](size_t i) {
+            size_t addr = begin + i;
+            failures.push_back({addr, pattern.words[addr % CompareKernel::PERIOD], buffer[i], pass});
+        });
+    }
+    if (_mode == TestExecutionMode::Visual && begin + count < n) {
+        // The animation steps through block starts (multiples of PROGRESS_UPDATE_INTERVAL)
+        publishSample(begin, expected(begin), buffer[0]);
+    } else {
+        size_t last = begin + count - 1;
+        publishSample(last, expected(last), buffer[count - 1]);
+    }
+}
+
+PhaseMetrics MemoryTester::collectPhase(const MarchElement& element, qint64 elapsedNs) const {
+    PhaseMetrics phase;
+    phase.notation = MarchParser::formatElement(element);
+    phase.elapsed_ns = elapsedNs;
+    for (const WorkerCounters& c : _counters) {
+        phase.words += c.words;
+        phase.reads += c.reads;
+        phase.writes += c.writes;
+        phase.fault_applications += c.access.fault_applications;
+        phase.lock_waits += c.access.lock_waits;
+        phase.lock_wait_ns += c.access.lock_wait_ns;
+    }
+    return phase;
+}
+
+void MemoryTester::paceVisualization() {
+    // Called on the tester thread after every block of a visual run.
+    // Remaining blocks are skipped after a cancel - no animation delay for them.
+    if (cancelled()) return;
+    QThread::msleep(VISUALIZATION_DELAY_MS);
+}
+
+void MemoryTester::emitFinished() {
+    TraceScope scope("emit finished", "signal");
+    quint64 flow = _finishedTrace.next();
+    Tracer::flowBegin("finished", flow);
+    emit finished(TestResultsPtr(std::move(_results)));
+}
+
+void MemoryTester::runTest(const MarchAlgorithm& algo, TestExecutionMode mode, int threads) {
+    TraceScope scope("runTest", "test");
+    if (scope.active()) scope.setDetail(QString("%1 %2, потоков: %3").arg(algo.name).arg(algo.notation).arg(threads));
+    _finishedTrace.newRun();
+    size_t n = _mem->size(); // Thread-safe call
+    _results = std::make_shared<TestResultSet>(n);
+    _mode = mode;
+    _blockWords = (mode == TestExecutionMode::Turbo) ? TURBO_BLOCK_WORDS : size_t(PROGRESS_UPDATE_INTERVAL);
+    _faults = _mem->faultSnapshot();
+    // The animation shows one address at a time, so only turbo runs use the pool;
+    // linked cells have to be visited in element order, so those runs are serial too
+    const bool serial = mode != TestExecutionMode::Turbo || _faults->faults.hasLinkedCells();
+    _executor.setThreadCount(serial ? 1 : threads);
+    _buffers.assign(size_t(_executor.threadCount()), std::vector<Word>(_blockWords));
+    _masks.assign(size_t(_executor.threadCount()), std::vector<quint64>(CompareKernel::maskWords(_blockWords)));
+    quint64 opsTotal = quint64(n) * algo.opsPerWord();
+    if (_progress) _progress->reset(opsTotal);
+    if (opsTotal == 0) {
+        _faults.reset();
+        if (_progress) _progress->complete();
+        emitFinished();
+        return;
+    }
+
+    switch (algo.background) {
+    case DataBackground::Solid:
+        runElements(algo, n, SolidBackground());
+        break;
+    case DataBackground::WalkingOnes:
+        runElements(algo, n, WalkingOnesBackground());
+        break;
+    case DataBackground::WalkingZeros:
+        runElements(algo, n, WalkingZerosBackground());
+        break;
+    }
+
+    _faults.reset();
+    _buffers.clear();
+    _masks.clear();
+    _blockDone.clear();
+    _counters.clear();
+    _results->finalize();
+    if (!_results->cancelled()) {
+        if (_progress) _progress->complete(); // Guarantee 100% at the end
+    }
+    emitFinished();
+}
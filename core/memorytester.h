@@ -0,0 +1,97 @@
+#ifndef MEMORYTESTER_H
+#define MEMORYTESTER_H
+
+#include <QObject>
+#include <QElapsedTimer>
+#include <vector>
+#include "types.h"
+#include "memorymodel.h"
+#include "marchtest.h"
+#include "parallelexecutor.h"
+#include "testresultset.h"
+#include "runcontrol.h"
+#include "progressstate.h"
+#include "comparekernel.h"
+#include "testmetrics.h"
+#include "tracer.h"
+#include "constants.h"
+
+
+class MemoryTester : public QObject {
+Q_OBJECT
+public:
+explicit MemoryTester(MemoryModel* mem, QObject* parent = nullptr);
+~MemoryTester() override = default;
+
+
+// blocking call — meant to run in a worker thread.
+// Turbo runs are split into partitions processed by up to `threads` pool workers;
+// visual runs and runs with coupling faults are single-threaded.
+// A cancelled run still emits finished() with the results of the blocks that completed.
+void runTest(const MarchAlgorithm& algo, TestExecutionMode mode = TestExecutionMode::Visual, int threads = 1);
+
+// Cancel/pause requests checked before every block; nullptr runs uncontrolled
+void setRunControl(RunControl* control) { _control = control; }
+// Progress and the latest read sample are stored here for polling; nullptr reports nothing
+void setProgressState(ProgressState* progress) { _progress = progress; }
+
+
+signals:
+void finished(const TestResultsPtr& results);
+
+
+private:
+    // March engine: every algorithm is a sequence of elements executed block by block
+    // through the bulk MemoryModel API, specialised once per data background.
+    // A block is also the unit of parallel work (a partition).
+    template <typename Background>
+    void runElements(const MarchAlgorithm& algo, size_t n, Background background);
+    template <typename Background>
+    void runBlock(const MarchElement& element, size_t block, size_t n, quint32 passBase, Background background,
+                  int worker, std::vector<TestFailure>& failures);
+    // Applies all operations of the element to [begin, begin + count), one operation at a time
+    template <typename Background>
+    void runOps(const MarchElement& element, size_t begin, size_t count, size_t n, quint32 passBase,
+                Background background, int worker, std::vector<TestFailure>& failures);
+    // Cancellation point between blocks (blocks while paused)
+    bool checkpoint() { return !_control || _control->checkpoint(); }
+    bool cancelled() const { return _control && _control->isCancelled(); }
+    template <typename Background>
+    void verifyBlock(size_t begin, size_t count, size_t n, Background background, Word invert, quint32 pass,
+                     int worker, std::vector<TestFailure>& failures);
+    PhaseMetrics collectPhase(const MarchElement& element, qint64 elapsedNs) const;
+    void paceVisualization();
+    void publishSample(size_t addr, Word expected, Word read) {
+        if (_progress) _progress->publishSample(addr, expected, read);
+    }
+    // Emit with a trace flow towards the receiving thread
+    void emitFinished();
+    
+    MemoryModel* _mem;
+    RunControl* _control;
+    ProgressState* _progress;
+    std::shared_ptr<const FaultSnapshot> _faults; // Faults of the current run (for linked cells)
+    ParallelExecutor _executor;
+    std::shared_ptr<TestResultSet> _results; // Built during a run, published by finished()
+    std::vector<TestFailure> _failures; // Serial runs: failures of the current element
+    std::vector<std::vector<TestFailure>> _blockFailures; // Parallel runs: per-partition failures, merged per element
+    std::vector<std::vector<Word>> _buffers; // Scratch block per worker for bulk reads
+    std::vector<std::vector<quint64>> _masks; // Mismatch bitmask per worker, one bit per word of the block
+    std::vector<char> _blockDone; // Blocks of the current element that ran to completion
+
+    // Per-worker counters of the current element, summed into PhaseMetrics after the barrier.
+    // Padded so that workers never write to the same cache line.
+    struct WorkerCounters {
+        MemoryAccessStats access;
+        quint64 words = 0;
+        quint64 reads = 0;
+        quint64 writes = 0;
+        char padding[CACHE_LINE_SIZE];
+    };
+    std::vector<WorkerCounters> _counters;
+    TestExecutionMode _mode;
+    size_t _blockWords;
+
+    TraceChannel _finishedTrace;
+};
+#endif // MEMORYTESTER_H
@@ -0,0 +1,56 @@
+#include "memorytopology.h"
+#include "constants.h"
+
+MemoryTopology::MemoryTopology()
+    : _words(0), _columns(1), _columnMask(0), _columnShift(0), _scramble(AddressScramble::None),
+      _toPhysicalColumn(1, 0), _toLogicalColumn(1, 0) {}
+
+MemoryTopology::MemoryTopology(size_t words, size_t columns, AddressScramble scramble)
+    : _words(words), _columns(isValidColumns(columns) ? columns : DEFAULT_TOPOLOGY_COLUMNS),
+      _columnMask(0), _columnShift(0), _scramble(scramble) {
+    while ((size_t(1) << _columnShift) < _columns) ++_columnShift;
+    _columnMask = _columns - 1;
+
+    _toPhysicalColumn.resize(_columns);
+    _toLogicalColumn.resize(_columns);
+    for (size_t column = 0; column < _columns; ++column) {
+        uint32_t physical = uint32_t(column);
+        if (_scramble == AddressScramble::ColumnReverse) {
+            physical = 0;
+            for (int bit = 0; bit < _columnShift; ++bit) {
+                if (column & (size_t(1) << bit)) physical |= 1u << (_columnShift - 1 - bit);
+            }
+        }
+        _toPhysicalColumn[column] = physical;
+        _toLogicalColumn[physical] = uint32_t(column);
+    }
+}
+
+bool MemoryTopology::isValidColumns(size_t columns) {
+    return columns >= 1 && columns <= MAX_TOPOLOGY_COLUMNS && (columns & (columns - 1)) == 0;
+}
+
+bool MemoryTopology::addressAt(size_t row, size_t column, size_t& addr) const {
+    if (column >= _columns) return false;
+    size_t logicalRow = twistRow(row); // The twist is its own inverse
+    if (logicalRow >= rows()) return false;
+    addr = (logicalRow << _columnShift) | _toLogicalColumn[column];
+    return addr < _words;
+}
+
+int MemoryTopology::neighbors(size_t addr, int neighborhood, size_t* out) const {
+    static const int OFFSETS[8][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}, {-1, -1}, {-1, 1}, {1, -1}, {1, 1}};
+    if (addr >= _words) return 0;
+    const size_t row = physicalRow(addr);
+    const size_t column = physicalColumn(addr);
+    const int count = neighborhood == 8 ? 8 : 4;
+    int found = 0;
+    for (int i = 0; i < count; ++i) {
+        if ((OFFSETS[i][0] < 0 && row == 0) || (OFFSETS[i][1] < 0 && column == 0)) continue;
+        size_t r = OFFSETS[i][0] < 0 ? row - 1 : row + size_t(OFFSETS[i][0]);
+        size_t c = OFFSETS[i][1] < 0 ? column - 1 : column + size_t(OFFSETS[i][1]);
+        size_t neighbor = 0;
+        if (addressAt(r, c, neighbor)) out[found++] = neighbor;
+    }
+    return found;
+}
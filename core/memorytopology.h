@@ -0,0 +1,55 @@
+#ifndef MEMORYTOPOLOGY_H
+#define MEMORYTOPOLOGY_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include "types.h"
+
+// Physical layout of the cell array: words are placed in rows of `columns` cells.
+// The number of columns is a power of two, so a logical address splits into row and
+// column with a shift and a mask. Scrambling then maps the logical column and row to
+// the physical ones: columns through a precomputed permutation table, rows through
+// an involution (RowTwist swaps rows 2 and 3 of every group of four).
+// The last row may be partial; positions at or beyond `words` hold no cell.
+//
+// Immutable after construction, shared by fault snapshots.
+class MemoryTopology {
+public:
+    MemoryTopology(); // Empty array: no cell has neighbors
+    MemoryTopology(size_t words, size_t columns, AddressScramble scramble);
+
+    // Columns must be a power of two in 1..MAX_TOPOLOGY_COLUMNS
+    static bool isValidColumns(size_t columns);
+
+    size_t words() const { return _words; }
+    size_t columns() const { return _columns; }
+    size_t rows() const { return _columns ? (_words + _columns - 1) >> _columnShift : 0; }
+    AddressScramble scramble() const { return _scramble; }
+
+    // Physical position of a logical address
+    size_t physicalRow(size_t addr) const { return twistRow(addr >> _columnShift); }
+    size_t physicalColumn(size_t addr) const { return _toPhysicalColumn[addr & _columnMask]; }
+    // Logical address of a physical position; false if no cell is there
+    bool addressAt(size_t row, size_t column, size_t& addr) const;
+
+    // Logical addresses of the physical 4-neighbors (north, south, west, east) or 8-neighbors
+    // of addr, in that order followed by the diagonals; cells on the border have fewer.
+    // Returns the number written to out (at most 8).
+    int neighbors(size_t addr, int neighborhood, size_t* out) const;
+
+private:
+    size_t twistRow(size_t row) const {
+        return _scramble == AddressScramble::RowTwist ? row ^ ((row >> 1) & 1) : row;
+    }
+
+    size_t _words;
+    size_t _columns;
+    size_t _columnMask;
+    int _columnShift;
+    AddressScramble _scramble;
+    std::vector<uint32_t> _toPhysicalColumn; // Logical column -> physical column
+    std::vector<uint32_t> _toLogicalColumn;  // Inverse permutation
+};
+
+#endif // MEMORYTOPOLOGY_H
@@ -0,0 +1,74 @@
+#include "parallelexecutor.h"
+#include <QRunnable>
+#include <QThread>
+#include <atomic>
+#include <algorithm>
+
+namespace {
+
+// One pool task per worker; it keeps claiming partitions until none are left
+class PartitionWorker : public QRunnable {
+public:
+    PartitionWorker(std::atomic<size_t>* next, size_t count, int worker, const ParallelExecutor::Body* body)
+        : _next(next), _count(count), _worker(worker), _body(body) {}
+
+    void run() override {
+        for (;;) {
+            size_t partition = _next->fetch_add(1, std::memory_order_relaxed);
+            if (partition >= _count) break;
+            (*_body)(partition, _worker);
+        }
+    }
+
+private:
+    std::atomic<size_t>* _next;
+    size_t _count;
+    int _worker;
+    const ParallelExecutor::Body* _body;
+};
+
+} // namespace
+
+ParallelExecutor::ParallelExecutor(int threads)
+    : _threads(1) {
+    setThreadCount(threads);
+    // Workers are reused for every element and every run
+    _pool.setExpiryTimeout(-1);
+}
+
+ParallelExecutor::~ParallelExecutor() {
+    _pool.waitForDone();
+}
+
+void ParallelExecutor::setThreadCount(int threads) {
+    _threads = std::max(1, threads);
+    _pool.setMaxThreadCount(_threads);
+}
+
+int ParallelExecutor::defaultThreadCount() {
+    return std::max(1, QThread::idealThreadCount());
+}
+
+void ParallelExecutor::forEach(size_t count, const Body& body, const Poll& poll, int pollIntervalMs) {
+    if (_threads == 1 || count <= 1) {
+        // Serial path: no hand-off to the pool, the caller's thread does the work
+        for (size_t partition = 0; partition < count; ++partition) {
+            body(partition, 0);
+            if (poll) poll();
+        }
+        return;
+    }
+
+    std::atomic<size_t> next(0);
+    int workers = int(std::min<size_t>(size_t(_threads), count));
+    for (int worker = 0; worker < workers; ++worker) {
+        PartitionWorker* task = new PartitionWorker(&next, count, worker, &body);
+        task->setAutoDelete(true);
+        _pool.start(task);
+    }
+    // Barrier: wait for all workers, reporting progress meanwhile
+    while (!_pool.waitForDone(pollIntervalMs)) {
+        if (poll) poll();
+    }
+    if (poll) poll();
+}
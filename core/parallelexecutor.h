@@ -0,0 +1,42 @@
+#ifndef PARALLELEXECUTOR_H
+#define PARALLELEXECUTOR_H
+
+#include <QThreadPool>
+#include <functional>
+#include <cstddef>
+#include "constants.h"
+
+// Worker pool for partitioned test execution.
+// forEach() is a barrier: it returns only after every partition has been processed,
+// so consecutive calls (one per march element) never overlap. Within a call the
+// partitions are claimed from a shared counter in increasing order, which balances
+// the load dynamically and keeps each worker on contiguous, cache-aligned ranges.
+class ParallelExecutor {
+public:
+    // body(partition, worker): worker is in [0, threadCount()) and identifies per-thread scratch data
+    using Body = std::function<void(size_t partition, int worker)>;
+    using Poll = std::function<void()>;
+
+    explicit ParallelExecutor(int threads = 1);
+    ~ParallelExecutor();
+
+    ParallelExecutor(const ParallelExecutor&) = delete;
+    ParallelExecutor& operator=(const ParallelExecutor&) = delete;
+
+    int threadCount() const { return _threads; }
+    void setThreadCount(int threads);
+
+    // Runs body for partitions [0, count). Blocks the calling thread, which calls poll()
+    // about every pollIntervalMs (after every partition when running single-threaded).
+    void forEach(size_t count, const Body& body, const Poll& poll = Poll(),
+                 int pollIntervalMs = PROGRESS_REPORT_INTERVAL_MS);
+
+    // Default worker count: one per logical core
+    static int defaultThreadCount();
+
+private:
+    QThreadPool _pool;
+    int _threads;
+};
+
+#endif // PARALLELEXECUTOR_H
@@ -0,0 +1,48 @@
+#include "progressstate.h"
+#include <algorithm>
+
+ProgressState::ProgressState()
+    : _done(0), _total(0), _sequence(0), _addr(0), _expected(0), _read(0) {}
+
+void ProgressState::reset(quint64 totalOps) {
+    _total.store(totalOps, std::memory_order_relaxed);
+    _done.store(0, std::memory_order_relaxed);
+    _sequence.store(0, std::memory_order_release);
+}
+
+int ProgressState::percent() const {
+    quint64 total = _total.load(std::memory_order_relaxed);
+    if (total == 0) return 0;
+    quint64 done = std::min(_done.load(std::memory_order_relaxed), total);
+    return int((done * PROGRESS_MAX_PERCENT) / total);
+}
+
+void ProgressState::publishSample(size_t addr, Word expected, Word read) {
+    quint64 sequence = _sequence.load(std::memory_order_relaxed);
+    if ((sequence & 1) || !_sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_acquire)) {
+        return;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    _addr.store(addr, std::memory_order_relaxed);
+    _expected.store(expected, std::memory_order_relaxed);
+    _read.store(read, std::memory_order_relaxed);
+    _sequence.store(sequence + 2, std::memory_order_release);
+}
+
+bool ProgressState::latestSample(ProgressSample& sample, quint64* version) const {
+    for (;;) {
+        quint64 before = _sequence.load(std::memory_order_acquire);
+        if (before == 0) return false;
+        if (before & 1) continue; // A writer is in the middle of an update - it finishes quickly
+        ProgressSample copy;
+        copy.addr = size_t(_addr.load(std::memory_order_relaxed));
+        copy.expected = _expected.load(std::memory_order_relaxed);
+        copy.read = _read.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (_sequence.load(std::memory_order_relaxed) == before) {
+            sample = copy;
+            if (version) *version = before / 2;
+            return true;
+        }
+    }
+}
@@ -0,0 +1,47 @@
+#ifndef PROGRESSSTATE_H
+#define PROGRESSSTATE_H
+
+#include <QtGlobal>
+#include <atomic>
+#include <cstddef>
+#include "types.h"
+#include "constants.h"
+
+// Latest (address, expected, read) observed by the test engine
+struct ProgressSample {
+    size_t addr = 0;
+    Word expected = 0;
+    Word read = 0;
+};
+
+// Progress of a running test, shared lock-free between the engine and its observer.
+// Workers only store into it; the GUI polls it at its own frame rate, so the cost of
+// progress reporting does not depend on test throughput. The sample slot is a seqlock.
+class ProgressState {
+public:
+    ProgressState();
+
+    // Before a run: nothing done out of `totalOps`, no sample
+    void reset(quint64 totalOps);
+    void addDone(quint64 ops) { _done.fetch_add(ops, std::memory_order_relaxed); }
+    void complete() { _done.store(_total.load(std::memory_order_relaxed), std::memory_order_relaxed); }
+    int percent() const;
+
+    // Any worker. A sample published while another worker is publishing is dropped -
+    // any recent sample will do and writers never wait.
+    void publishSample(size_t addr, Word expected, Word read);
+    // Copies the latest sample; false if none was published since reset().
+    // `version` changes with every published sample, so unchanged samples can be skipped.
+    bool latestSample(ProgressSample& sample, quint64* version = nullptr) const;
+
+private:
+    std::atomic<quint64> _done;
+    std::atomic<quint64> _total;
+    char _padding[CACHE_LINE_SIZE]; // Keeps the worker counter and the sample slot apart
+    std::atomic<quint64> _sequence; // Odd while a sample is being written
+    std::atomic<quint64> _addr;
+    std::atomic<Word> _expected;
+    std::atomic<Word> _read;
+};
+
+#endif // PROGRESSSTATE_H
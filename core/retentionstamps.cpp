@@ -0,0 +1,57 @@
+#include "retentionstamps.h"
+#include <new>
+
+constexpr size_t RetentionStamps::NEW_FAULT;
+
+RetentionStamps::Table::~Table() {
+    for (size_t i = 0; i < chunkCount; ++i) {
+        delete[] chunks[i].load(std::memory_order_relaxed);
+    }
+}
+
+void RetentionStamps::build(const std::vector<InjectedFault>& faults, quint64 now,
+                            const RetentionStamps* previous, const std::vector<size_t>& previousIndex) {
+    _tables.clear();
+    _tables.resize(faults.size());
+    for (size_t i = 0; i < faults.size(); ++i) {
+        const InjectedFault& f = faults[i];
+        if (f.model != FaultModel::Retention || f.len == 0) continue;
+        const size_t from = i < previousIndex.size() ? previousIndex[i] : NEW_FAULT;
+        if (previous && from < previous->_tables.size() && previous->_tables[from]) {
+            _tables[i] = previous->_tables[from]; // Same fault: keep its stamps
+            continue;
+        }
+        _tables[i] = std::make_shared<Table>();
+        Table& t = *_tables[i];
+        t.chunkCount = (f.len + RETENTION_CHUNK_CELLS - 1) >> RETENTION_CHUNK_SHIFT;
+        t.origin = quint32(now);
+        t.chunks.reset(new std::atomic<quint32*>[t.chunkCount]);
+        for (size_t c = 0; c < t.chunkCount; ++c) {
+            t.chunks[c].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+}
+
+void RetentionStamps::touch(size_t fault, size_t offset, quint64 now) {
+    Table& t = *_tables[fault];
+    size_t chunkIndex = offset >> RETENTION_CHUNK_SHIFT;
+    quint32* chunk = t.chunks[chunkIndex].load(std::memory_order_acquire);
+    if (!chunk) {
+        chunk = allocateChunk(t, chunkIndex);
+        if (!chunk) return; // Out of memory: the cell keeps aging from the table origin
+    }
+    chunk[offset & (RETENTION_CHUNK_CELLS - 1)] = quint32(now);
+}
+
+quint32* RetentionStamps::allocateChunk(Table& t, size_t chunkIndex) {
+    quint32* chunk = new (std::nothrow) quint32[RETENTION_CHUNK_CELLS];
+    if (!chunk) return nullptr;
+    for (size_t i = 0; i < RETENTION_CHUNK_CELLS; ++i) chunk[i] = t.origin;
+    // Another writer may have installed a chunk meanwhile - keep theirs
+    quint32* expected = nullptr;
+    if (!t.chunks[chunkIndex].compare_exchange_strong(expected, chunk, std::memory_order_acq_rel)) {
+        delete[] chunk;
+        return expected;
+    }
+    return chunk;
+}
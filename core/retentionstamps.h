@@ -0,0 +1,63 @@
+#ifndef RETENTIONSTAMPS_H
+#define RETENTIONSTAMPS_H
+
+#include <QtGlobal>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include "types.h"
+#include "constants.h"
+
+// Last-write times of the cells covered by retention faults, in ticks of the simulated clock.
+// Only the low 32 bits of the clock are kept (4 bytes per cell), so ages are exact up to
+// 2^32 ticks. Stamps are allocated per RETENTION_CHUNK_CELLS on the first write into a chunk;
+// cells of a never-written chunk carry the time the table was built. Decay is evaluated
+// lazily on read from the age of the stamp - the clock can jump without touching any cell.
+//
+// The table of a fault is shared by every snapshot that contains the fault, so republishing
+// the fault set (another fault injected or removed, a new topology) keeps its timers running.
+//
+// Thread safety: age()/touch() may be called concurrently (chunk allocation is lock-free).
+class RetentionStamps {
+public:
+    // previousIndex entry of a fault that was not in the previous set
+    static constexpr size_t NEW_FAULT = ~size_t(0);
+
+    RetentionStamps() = default;
+
+    RetentionStamps(const RetentionStamps&) = delete;
+    RetentionStamps& operator=(const RetentionStamps&) = delete;
+
+    // One table per retention fault of `faults` (indexed like faults). Fault i takes over the
+    // table of fault previousIndex[i] of `previous`; new faults start with every cell at `now`.
+    void build(const std::vector<InjectedFault>& faults, quint64 now,
+               const RetentionStamps* previous = nullptr, const std::vector<size_t>& previousIndex = std::vector<size_t>());
+
+    // Ticks since the last write of cell `offset` of fault `fault`
+    quint64 age(size_t fault, size_t offset, quint64 now) const {
+        const Table& t = *_tables[fault];
+        const quint32* chunk = t.chunks[offset >> RETENTION_CHUNK_SHIFT].load(std::memory_order_acquire);
+        quint32 stamp = chunk ? chunk[offset & (RETENTION_CHUNK_CELLS - 1)] : t.origin;
+        return quint32(quint32(now) - stamp);
+    }
+    void touch(size_t fault, size_t offset, quint64 now);
+
+private:
+    struct Table {
+        Table() = default;
+        Table(const Table&) = delete;
+        Table& operator=(const Table&) = delete;
+        ~Table();
+
+        size_t chunkCount = 0;
+        quint32 origin = 0;
+        std::unique_ptr<std::atomic<quint32*>[]> chunks;
+    };
+
+    static quint32* allocateChunk(Table& t, size_t chunkIndex);
+
+    std::vector<std::shared_ptr<Table>> _tables; // Null for faults of other models
+};
+
+#endif // RETENTIONSTAMPS_H
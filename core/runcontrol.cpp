@@ -0,0 +1,36 @@
+#include "runcontrol.h"
+
+RunControl::RunControl()
+    : _state(Running) {}
+
+void RunControl::reset() {
+    QMutexLocker locker(&_mutex);
+    _state.store(Running);
+    _resumed.wakeAll();
+}
+
+void RunControl::requestCancel() {
+    QMutexLocker locker(&_mutex);
+    _state.store(Cancelled);
+    // Paused workers have to wake up to see the cancellation
+    _resumed.wakeAll();
+}
+
+void RunControl::pause() {
+    QMutexLocker locker(&_mutex);
+    if (_state.load() == Running) _state.store(Paused);
+}
+
+void RunControl::resume() {
+    QMutexLocker locker(&_mutex);
+    if (_state.load() == Paused) _state.store(Running);
+    _resumed.wakeAll();
+}
+
+bool RunControl::waitWhilePaused() {
+    QMutexLocker locker(&_mutex);
+    while (_state.load() == Paused) {
+        _resumed.wait(&_mutex);
+    }
+    return _state.load() != Cancelled;
+}
@@ -0,0 +1,39 @@
+#ifndef RUNCONTROL_H
+#define RUNCONTROL_H
+
+#include <QMutex>
+#include <QWaitCondition>
+#include <atomic>
+
+// Cancel / pause / resume requests for a running test.
+// Requests may come from any thread (usually the GUI); the test engine polls
+// checkpoint() between blocks. The running fast path is one relaxed atomic load.
+class RunControl {
+public:
+    RunControl();
+
+    // Back to the running state; call before a run is started
+    void reset();
+    void requestCancel();
+    void pause();
+    void resume();
+
+    bool isCancelled() const { return _state.load(std::memory_order_relaxed) == Cancelled; }
+    bool isPaused() const { return _state.load(std::memory_order_relaxed) == Paused; }
+
+    // Cancellation point: blocks while paused, returns false once the run is cancelled
+    bool checkpoint() {
+        if (_state.load(std::memory_order_relaxed) == Running) return true;
+        return waitWhilePaused();
+    }
+
+private:
+    enum State { Running, Paused, Cancelled };
+    bool waitWhilePaused();
+
+    std::atomic<int> _state;
+    QMutex _mutex;
+    QWaitCondition _resumed;
+};
+
+#endif // RUNCONTROL_H
@@ -0,0 +1,15 @@
+#include "testmetrics.h"
+
+PhaseMetrics PhaseMetrics::total(const std::vector<PhaseMetrics>& phases) {
+    PhaseMetrics sum;
+    for (const PhaseMetrics& phase : phases) {
+        sum.words += phase.words;
+        sum.elapsed_ns += phase.elapsed_ns;
+        sum.reads += phase.reads;
+        sum.writes += phase.writes;
+        sum.fault_applications += phase.fault_applications;
+        sum.lock_waits += phase.lock_waits;
+        sum.lock_wait_ns += phase.lock_wait_ns;
+    }
+    return sum;
+}
@@ -0,0 +1,26 @@
+#ifndef TESTMETRICS_H
+#define TESTMETRICS_H
+
+#include <QString>
+#include <vector>
+
+// Instrumentation of one march element (a phase of the test)
+struct PhaseMetrics {
+    QString notation;                // The element, e.g. "⇑(r0,w1)"
+    size_t words = 0;                // Addresses processed
+    qint64 elapsed_ns = 0;           // Wall-clock time of the element, barrier included
+    quint64 reads = 0;               // Word reads (each one verified)
+    quint64 writes = 0;              // Word writes
+    quint64 fault_applications = 0;  // Faulty words read, once per covering fault
+    quint64 lock_waits = 0;          // Bulk accesses that had to wait for the memory layout lock
+    qint64 lock_wait_ns = 0;         // Summed over all workers
+
+    quint64 operations() const { return reads + writes; }
+    double wordsPerSecond() const { return elapsed_ns > 0 ? words * 1e9 / elapsed_ns : 0.0; }
+    double nsPerOperation() const { return operations() > 0 ? double(elapsed_ns) / operations() : 0.0; }
+
+    // Sum of a list of phases (notation left empty)
+    static PhaseMetrics total(const std::vector<PhaseMetrics>& phases);
+};
+
+#endif // TESTMETRICS_H
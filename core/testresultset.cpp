@@ -0,0 +1,120 @@
+#include "testresultset.h"
+#include <QtAlgorithms>
+#include <algorithm>
+
+namespace {
+
+inline int lowestSetBit(quint64 bits) {
+#if defined(Q_CC_GNU)
+    return __builtin_ctzll(bits);
+#else
+    int index = 0;
+    while (!(bits & 1u)) { bits >>= 1; ++index; }
+    return index;
+#endif
+}
+
+size_t countBits(const std::vector<quint64>& bitmap) {
+    size_t count = 0;
+    for (quint64 bits : bitmap) count += qPopulationCount(bits);
+    return count;
+}
+
+} // namespace
+
+TestResultSet::TestResultSet(size_t words)
+    : _words(words), _tested((words + 63) / 64, 0), _failed((words + 63) / 64, 0), _reads(0), _cancelled(false) {}
+
+size_t TestResultSet::testedCount() const {
+    return countBits(_tested);
+}
+
+size_t TestResultSet::failedCount() const {
+    return countBits(_failed);
+}
+
+size_t TestResultSet::failedCountIn(size_t begin, size_t end) const {
+    return countBitsIn(_failed, begin, std::min(end, _words));
+}
+
+size_t TestResultSet::countBitsIn(const std::vector<quint64>& bitmap, size_t begin, size_t end) {
+    if (begin >= end) return 0;
+    size_t first = begin >> 6;
+    size_t last = (end - 1) >> 6;
+    quint64 headMask = ~quint64(0) << (begin & 63);
+    quint64 tailMask = ~quint64(0) >> (63 - ((end - 1) & 63));
+    if (first == last) return qPopulationCount(bitmap[first] & headMask & tailMask);
+    size_t count = qPopulationCount(bitmap[first] & headMask);
+    for (size_t word = first + 1; word < last; ++word) count += qPopulationCount(bitmap[word]);
+    return count + qPopulationCount(bitmap[last] & tailMask);
+}
+
+void TestResultSet::markTested(size_t begin, size_t count) {
+    size_t end = std::min(begin + count, _words);
+    size_t addr = begin;
+    // Partial leading word, whole words, partial trailing word
+    while (addr < end && (addr & 63)) {
+        _tested[addr >> 6] |= quint64(1) << (addr & 63);
+        ++addr;
+    }
+    for (; addr + 64 <= end; addr += 64) {
+        _tested[addr >> 6] = ~quint64(0);
+    }
+    for (; addr < end; ++addr) {
+        _tested[addr >> 6] |= quint64(1) << (addr & 63);
+    }
+}
+
+void TestResultSet::addFailures(std::vector<TestFailure>& failures) {
+    for (const TestFailure& f : failures) {
+        if (f.addr < _words) _failed[f.addr >> 6] |= quint64(1) << (f.addr & 63);
+    }
+    if (_failures.empty()) {
+        _failures.swap(failures);
+    } else {
+        _failures.insert(_failures.end(), failures.begin(), failures.end());
+    }
+    failures.clear();
+}
+
+void TestResultSet::finalize() {
+    _failureIndex.resize(_failures.size());
+    for (size_t i = 0; i < _failures.size(); ++i) _failureIndex[i] = i;
+    const std::vector<TestFailure>& failures = _failures;
+    std::stable_sort(_failureIndex.begin(), _failureIndex.end(), [&failures](size_t a, size_t b) {
+        return failures[a].addr < failures[b].addr;
+    });
+}
+
+const TestFailure* TestResultSet::lastFailureAt(size_t addr) const {
+    if (!isFailed(addr)) return nullptr;
+    const std::vector<TestFailure>& failures = _failures;
+    auto it = std::upper_bound(_failureIndex.begin(), _failureIndex.end(), addr, [&failures](size_t a, size_t index) {
+        return a < failures[index].addr;
+    });
+    if (it == _failureIndex.begin() || failures[*(it - 1)].addr != addr) return nullptr;
+    return &failures[*(it - 1)];
+}
+
+bool TestResultSet::findFailedFrom(size_t begin, size_t end, size_t& found) const {
+    if (begin >= end) return false;
+    size_t word = begin >> 6;
+    quint64 bits = _failed[word] & (~quint64(0) << (begin & 63));
+    size_t lastWord = (end - 1) >> 6;
+    for (;;) {
+        if (bits) {
+            size_t addr = (word << 6) + size_t(lowestSetBit(bits));
+            if (addr >= end) return false;
+            found = addr;
+            return true;
+        }
+        if (++word > lastWord) return false;
+        bits = _failed[word];
+    }
+}
+
+bool TestResultSet::nextFailedAddress(size_t addr, size_t& next) const {
+    if (_words == 0) return false;
+    size_t start = addr + 1 < _words ? addr + 1 : _words;
+    return findFailedFrom(start, _words, next) || findFailedFrom(0, std::min(start, _words), next);
+}
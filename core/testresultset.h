@@ -0,0 +1,75 @@
+#ifndef TESTRESULTSET_H
+#define TESTRESULTSET_H
+
+#include <QMetaType>
+#include <memory>
+#include <vector>
+#include "types.h"
+#include "testmetrics.h"
+
+// One mismatching read
+struct TestFailure {
+    size_t addr;
+    Word expected;
+    Word read;
+    quint32 pass; // Read operation within the run (also the fault RNG pass)
+};
+
+// Compact outcome of a test run: two bits per address (tested / failed) plus a
+// sparse list of the failing reads. Passing reads are not stored individually.
+// Built by MemoryTester, then shared read-only as TestResultsPtr.
+class TestResultSet {
+public:
+    explicit TestResultSet(size_t words = 0);
+
+    size_t size() const { return _words; }
+    bool empty() const { return _reads == 0; }
+    // The run was stopped early: only part of the addresses/elements were covered
+    bool cancelled() const { return _cancelled; }
+
+    bool isTested(size_t addr) const { return addr < _words && (_tested[addr >> 6] >> (addr & 63)) & 1u; }
+    bool isFailed(size_t addr) const { return addr < _words && (_failed[addr >> 6] >> (addr & 63)) & 1u; }
+
+    size_t testedCount() const;  // Distinct addresses that were read at least once
+    size_t failedCount() const;  // Distinct addresses with at least one failing read
+    size_t failedCountIn(size_t begin, size_t end) const; // Failed addresses within [begin, end)
+    quint64 readCount() const { return _reads; } // All verified reads
+    const std::vector<TestFailure>& failures() const { return _failures; } // In execution order
+
+    // Timing and counters of every executed march element, in execution order
+    const std::vector<PhaseMetrics>& phases() const { return _phases; }
+
+    // First failed address after `addr`, wrapping around to the start. False if there is none.
+    bool nextFailedAddress(size_t addr, size_t& next) const;
+    // Most recent failing read of an address, nullptr if it never failed (needs finalize())
+    const TestFailure* lastFailureAt(size_t addr) const;
+
+    // Building (MemoryTester only, single-threaded)
+    void markTested(size_t begin, size_t count);
+    void addReads(quint64 reads) { _reads += reads; }
+    void setCancelled() { _cancelled = true; }
+    void addPhase(const PhaseMetrics& phase) { _phases.push_back(phase); }
+    // Moves the failures out of `failures` and marks their addresses as failed
+    void addFailures(std::vector<TestFailure>& failures);
+    // Builds the per-address failure index; call once when the run is complete
+    void finalize();
+
+private:
+    static size_t countBitsIn(const std::vector<quint64>& bitmap, size_t begin, size_t end);
+    bool findFailedFrom(size_t begin, size_t end, size_t& found) const;
+
+    size_t _words;
+    std::vector<quint64> _tested;
+    std::vector<quint64> _failed;
+    std::vector<TestFailure> _failures;
+    std::vector<size_t> _failureIndex; // Indices into _failures sorted by address, then execution order
+    std::vector<PhaseMetrics> _phases;
+    quint64 _reads;
+    bool _cancelled;
+};
+
+using TestResultsPtr = std::shared_ptr<const TestResultSet>;
+
+Q_DECLARE_METATYPE(TestResultsPtr)
+
+#endif // TESTRESULTSET_H
@@ -0,0 +1,40 @@
+#include "teststatistics.h"
+#include "constants.h"
+#include <algorithm>
+
+double TestStatistics::coveragePercent() const {
+    return total_addresses > 0 ? tested_addresses * double(PROGRESS_MAX_PERCENT) / total_addresses : 0.0;
+}
+
+double TestStatistics::detectionPercent() const {
+    return fault_addresses > 0 ? detected_fault_addresses * double(PROGRESS_MAX_PERCENT) / fault_addresses
+                               : double(PROGRESS_MAX_PERCENT);
+}
+
+double TestStatistics::readsPerSecond() const {
+    return elapsed_ms > 0 ? reads * 1000.0 / elapsed_ms : 0.0;
+}
+
+TestStatistics TestStatistics::compute(size_t words, const TestResultSet* results,
+                                       const FaultSnapshot* faults, qint64 elapsedMs) {
+    TestStatistics stats;
+    stats.total_addresses = words;
+    stats.elapsed_ms = elapsedMs;
+    if (results) {
+        stats.tested_addresses = results->testedCount();
+        stats.failed_addresses = results->failedCount();
+        stats.failed_reads = results->failures().size();
+        stats.reads = results->readCount();
+    }
+    if (faults) {
+        // Segments are disjoint, so every faulty address is counted once
+        const FaultSet& set = faults->faults;
+        for (const FaultSet::Segment* seg = set.firstSegmentFrom(0); seg != set.segmentsEnd(); ++seg) {
+            size_t end = std::min(seg->end, words);
+            if (seg->begin >= end) continue;
+            stats.fault_addresses += end - seg->begin;
+            if (results) stats.detected_fault_addresses += results->failedCountIn(seg->begin, end);
+        }
+    }
+    return stats;
+}
@@ -0,0 +1,33 @@
+#ifndef TESTSTATISTICS_H
+#define TESTSTATISTICS_H
+
+#include <QtGlobal>
+#include <memory>
+#include "types.h"
+#include "faultinjector.h"
+#include "testresultset.h"
+
+// Summary figures of a test run, shared by the GUI statistics panel and the
+// headless runner. Pure computation over the result bitmaps and the fault set.
+struct TestStatistics {
+    size_t total_addresses = 0;
+    size_t tested_addresses = 0;
+    size_t failed_addresses = 0;       // Addresses with at least one failing read
+    size_t failed_reads = 0;
+    quint64 reads = 0;
+    size_t fault_addresses = 0;        // Addresses covered by injected faults
+    size_t detected_fault_addresses = 0; // ...of which at least one read failed
+    qint64 elapsed_ms = 0;
+
+    double coveragePercent() const;
+    // Share of faulty addresses the test caught; 100% when nothing was injected
+    double detectionPercent() const;
+    // Verified reads per second, 0 when the time is unknown
+    double readsPerSecond() const;
+
+    // results and faults may be null (no run yet / no faults)
+    static TestStatistics compute(size_t words, const TestResultSet* results,
+                                  const FaultSnapshot* faults, qint64 elapsedMs = 0);
+};
+
+#endif // TESTSTATISTICS_H
@@ -0,0 +1,213 @@
+#include "tracer.h"
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMutex>
+#include <QThread>
+#include <memory>
+#include <vector>
+
+std::atomic<bool> Tracer::s_enabled(false);
+
+namespace {
+
+// Caps memory use of a forgotten trace; later events of the thread are counted as dropped
+const size_t MAX_EVENTS_PER_THREAD = 4 * 1000 * 1000;
+
+struct TraceEvent {
+    const char* name;
+    const char* category;
+    char phase;        // 'X' span, 'i' instant, 's'/'f' flow start/end
+    qint64 begin;      // ns since start
+    qint64 duration;   // ns, spans only
+    quint64 id;        // flows only
+    QString detail;
+};
+
+// One per thread that ever recorded an event. Buffers live until the process
+// exits, so the thread-local pointer below never dangles.
+struct ThreadBuffer {
+    int tid;
+    QString name;
+    QMutex mutex; // Uncontended except while stop() collects the events
+    std::vector<TraceEvent> events;
+    quint64 dropped = 0;
+};
+
+struct TraceState {
+    QMutex mutex;
+    QString path;
+    QElapsedTimer clock;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+};
+
+TraceState& state() {
+    static TraceState s;
+    return s;
+}
+
+thread_local ThreadBuffer* t_buffer = nullptr;
+
+ThreadBuffer& threadBuffer() {
+    if (!t_buffer) {
+        TraceState& s = state();
+        QMutexLocker locker(&s.mutex);
+        std::unique_ptr<ThreadBuffer> buffer(new ThreadBuffer);
+        buffer->tid = int(s.buffers.size()) + 1;
+        QString objectName = QThread::currentThread() ? QThread::currentThread()->objectName() : QString();
+        buffer->name = objectName.isEmpty() ? QString("Поток %1").arg(buffer->tid) : objectName;
+        t_buffer = buffer.get();
+        s.buffers.push_back(std::move(buffer));
+    }
+    return *t_buffer;
+}
+
+void record(const char* name, const char* category, char phase, qint64 begin, qint64 duration, quint64 id,
+            const QString& detail) {
+    ThreadBuffer& buffer = threadBuffer();
+    QMutexLocker locker(&buffer.mutex);
+    if (buffer.events.size() >= MAX_EVENTS_PER_THREAD) {
+        ++buffer.dropped;
+        return;
+    }
+    TraceEvent event = {name, category, phase, begin, duration, id, detail};
+    buffer.events.push_back(event);
+}
+
+QByteArray jsonString(const QString& text) {
+    // Whole-string conversion keeps surrogate pairs together; UTF-8 continuation
+    // bytes are >= 0x80, so only the ASCII specials need escaping
+    const QByteArray utf8 = text.toUtf8();
+    QByteArray out;
+    out.reserve(utf8.size() + 2);
+    out += '"';
+    for (char c : utf8) {
+        const uchar u = uchar(c);
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (u < 0x20) {
+            char escape[8];
+            qsnprintf(escape, sizeof(escape), "\\u%04x", u);
+            out += escape;
+        } else {
+            out += c;
+        }
+    }
+    out += '"';
+    return out;
+}
+
+// Trace-event timestamps are microseconds
+QByteArray micros(qint64 ns) {
+    return QByteArray::number(double(ns) / 1000.0, 'f', 3);
+}
+
+} // namespace
+
+void Tracer::start(const QString& path) {
+    TraceState& s = state();
+    QMutexLocker locker(&s.mutex);
+    for (auto& buffer : s.buffers) {
+        QMutexLocker bufferLocker(&buffer->mutex);
+        buffer->events.clear();
+        buffer->dropped = 0;
+    }
+    s.path = path;
+    s.clock.start();
+    s_enabled.store(true);
+}
+
+QString Tracer::outputPath() {
+    TraceState& s = state();
+    QMutexLocker locker(&s.mutex);
+    return s.path;
+}
+
+qint64 Tracer::now() {
+    return state().clock.nsecsElapsed();
+}
+
+void Tracer::setThreadName(const QString& name) {
+    ThreadBuffer& buffer = threadBuffer();
+    QMutexLocker locker(&buffer.mutex);
+    buffer.name = name;
+}
+
+void Tracer::complete(const char* name, const char* category, qint64 beginNs, qint64 endNs, const QString& detail) {
+    if (!isEnabled()) return;
+    record(name, category, 'X', beginNs, endNs - beginNs, 0, detail);
+}
+
+void Tracer::instant(const char* name, const char* category, const QString& detail) {
+    if (!isEnabled()) return;
+    record(name, category, 'i', now(), 0, 0, detail);
+}
+
+void Tracer::flowBegin(const char* name, quint64 id) {
+    if (!isEnabled()) return;
+    record(name, "flow", 's', now(), 0, id, QString());
+}
+
+void Tracer::flowEnd(const char* name, quint64 id) {
+    if (!isEnabled()) return;
+    record(name, "flow", 'f', now(), 0, id, QString());
+}
+
+bool Tracer::stop(QString* errorMessage) {
+    if (!s_enabled.exchange(false)) return true;
+
+    TraceState& s = state();
+    QMutexLocker locker(&s.mutex);
+    QFile file(s.path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        if (errorMessage) *errorMessage = QString("Не удалось открыть файл трассировки %1: %2").arg(s.path).arg(file.errorString());
+        return false;
+    }
+
+    QByteArray out = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    auto separator = [&out, &first]() {
+        if (!first) out += ",\n";
+        first = false;
+    };
+    for (auto& buffer : s.buffers) {
+        QMutexLocker bufferLocker(&buffer->mutex);
+        const QByteArray tid = QByteArray::number(buffer->tid);
+        separator();
+        out += "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" + tid
+             + ",\"args\":{\"name\":" + jsonString(buffer->name) + "}}";
+        for (const TraceEvent& e : buffer->events) {
+            separator();
+            out += "{\"ph\":\"";
+            out += e.phase;
+            out += "\",\"name\":" + jsonString(QString::fromUtf8(e.name))
+                 + ",\"cat\":" + jsonString(QString::fromUtf8(e.category))
+                 + ",\"pid\":1,\"tid\":" + tid + ",\"ts\":" + micros(e.begin);
+            if (e.phase == 'X') out += ",\"dur\":" + micros(e.duration);
+            if (e.phase == 'i') out += ",\"s\":\"t\"";
+            if (e.phase == 's' || e.phase == 'f') out += ",\"id\":" + QByteArray::number(e.id);
+            if (e.phase == 'f') out += ",\"bp\":\"e\"";
+            if (!e.detail.isEmpty()) out += ",\"args\":{\"detail\":" + jsonString(e.detail) + "}";
+            out += "}";
+            if (out.size() > (1 << 20)) {
+                file.write(out);
+                out.clear();
+            }
+        }
+        if (buffer->dropped > 0) {
+            separator();
+            out += "{\"ph\":\"i\",\"s\":\"t\",\"name\":\"events dropped\",\"cat\":\"tracer\",\"pid\":1,\"tid\":" + tid
+                 + ",\"ts\":" + micros(s.clock.nsecsElapsed())
+                 + ",\"args\":{\"count\":" + QByteArray::number(buffer->dropped) + "}}";
+        }
+        buffer->events.clear();
+        buffer->dropped = 0;
+    }
+    out += "\n]}\n";
+    file.write(out);
+    if (!file.flush() || file.error() != QFile::NoError) {
+        if (errorMessage) *errorMessage = QString("Ошибка записи трассировки %1: %2").arg(s.path).arg(file.errorString());
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,73 @@
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <QString>
+#include <atomic>
+
+// Optional execution tracing in the Chrome trace-event format (chrome://tracing,
+// ui.perfetto.dev). Disabled by default; when disabled every call is a single
+// relaxed atomic load. Events are buffered per thread and written by stop().
+class Tracer {
+public:
+    // Starts recording; events go to `path` when stop() is called
+    static void start(const QString& path);
+    // Stops recording and writes the file. False (with a message) if it could not be written.
+    static bool stop(QString* errorMessage = nullptr);
+    static bool isEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+    static QString outputPath();
+
+    // Label of the calling thread in the trace viewer
+    static void setThreadName(const QString& name);
+
+    // Nanoseconds since start()
+    static qint64 now();
+    // Span [beginNs, endNs) on the calling thread
+    static void complete(const char* name, const char* category, qint64 beginNs, qint64 endNs,
+                         const QString& detail = QString());
+    static void instant(const char* name, const char* category, const QString& detail = QString());
+    // Arrow from the enclosing span of flowBegin to the enclosing span of flowEnd with the same name and id,
+    // e.g. a signal emitted on the tester thread and delivered on the GUI thread
+    static void flowBegin(const char* name, quint64 id);
+    static void flowEnd(const char* name, quint64 id);
+
+private:
+    static std::atomic<bool> s_enabled;
+};
+
+// Records the lifetime of a scope as a span. `name` and `category` must be string literals.
+class TraceScope {
+public:
+    TraceScope(const char* name, const char* category)
+        : _name(name), _category(category), _begin(Tracer::isEnabled() ? Tracer::now() : -1) {}
+    ~TraceScope() {
+        if (_begin >= 0) Tracer::complete(_name, _category, _begin, Tracer::now(), _detail);
+    }
+
+    bool active() const { return _begin >= 0; }
+    // Shown as the span's argument; only build it when active()
+    void setDetail(const QString& detail) { _detail = detail; }
+
+private:
+    TraceScope(const TraceScope&);
+    TraceScope& operator=(const TraceScope&);
+
+    const char* _name;
+    const char* _category;
+    qint64 _begin;
+    QString _detail;
+};
+
+// Numbers the signals of one queued connection so that the emitting and the
+// receiving side agree on flow ids without passing them along: queued delivery
+// keeps the emission order. Both sides call newRun() when a test starts.
+class TraceChannel {
+public:
+    void newRun() { ++_run; _seq = 0; }
+    quint64 next() { return (quint64(_run) << 32) | ++_seq; }
+
+private:
+    quint32 _run = 0;
+    quint32 _seq = 0;
+};
+
+#endif // TRACER_H
@@ -0,0 +1,109 @@
+#ifndef TYPES_H
+#define TYPES_H
+
+#include <cstdint>
+#include <vector>
+#include "constants.h"
+
+// Базовый тип для слова памяти
+using Word = uint32_t;
+
+// Модели неисправностей
+enum class FaultModel {
+    None,
+    StuckAt0,
+    StuckAt1,
+    BitFlip,
+    OpenRead,
+    // Неисправности связи (coupling faults): запись в ячейку-агрессор влияет на ячейку-жертву
+    CouplingInversion,   // CFin: переход агрессора в trigger_value инвертирует жертву
+    CouplingIdempotent,  // CFid: переход агрессора в trigger_value записывает в жертву forced_value
+    CouplingState,       // CFst: пока агрессор хранит trigger_value, жертва хранит forced_value
+    // Неисправности переходов (transition faults): бит ячейки не может изменить значение
+    TransitionUp,        // TF↑: переход 0→1 не выполняется
+    TransitionDown,      // TF↓: переход 1→0 не выполняется
+    // Неисправность хранения (data retention fault)
+    Retention,           // DRF: через retention_ticks тактов без записи ячейка читается как forced_value
+    // Неисправности дешифратора адреса (address decoder faults)
+    AddressNoCell,       // AF: адрес не выбирает ни одной ячейки (запись теряется, чтение даёт forced_value)
+    AddressRemap,        // AF: адрес выбирает ячейку target_addr вместо своей
+    AddressMulti,        // AF: адрес выбирает свою ячейку и ячейку target_addr (чтение - И значений)
+    // Неисправности, чувствительные к соседству (NPSF): базовая ячейка зависит от физических соседей
+    NeighborhoodActive,  // ANPSF: переход соседа, завершающий шаблон trigger_value, инвертирует базовую ячейку
+    NeighborhoodPassive, // PNPSF: пока соседи хранят шаблон trigger_value, базовая ячейка не меняется
+    NeighborhoodStatic   // SNPSF: пока соседи хранят шаблон trigger_value, базовая ячейка хранит forced_value
+};
+
+// Перемешивание адресов: логический адрес -> физическое положение ячейки в матрице
+enum class AddressScramble {
+    None,           // Строка = addr / columns, столбец = addr % columns
+    ColumnReverse,  // Биты номера столбца переставлены в обратном порядке
+    RowTwist        // В каждой четвёрке строк строки 2 и 3 поменяны местами
+};
+
+// Coupling faults act on the write path and involve two addresses
+inline bool isCouplingFault(FaultModel model) {
+    return model == FaultModel::CouplingInversion || model == FaultModel::CouplingIdempotent
+        || model == FaultModel::CouplingState;
+}
+
+inline bool isTransitionFault(FaultModel model) {
+    return model == FaultModel::TransitionUp || model == FaultModel::TransitionDown;
+}
+
+inline bool isDecoderFault(FaultModel model) {
+    return model == FaultModel::AddressNoCell || model == FaultModel::AddressRemap
+        || model == FaultModel::AddressMulti;
+}
+
+// Neighborhood pattern-sensitive faults involve the physical neighbors of a cell (see MemoryTopology)
+inline bool isNeighborhoodFault(FaultModel model) {
+    return model == FaultModel::NeighborhoodActive || model == FaultModel::NeighborhoodPassive
+        || model == FaultModel::NeighborhoodStatic;
+}
+
+// Faults that have to see every write to their cells (a write to them cannot bypass the injector)
+inline bool actsOnWrite(FaultModel model) {
+    return isCouplingFault(model) || isTransitionFault(model) || model == FaultModel::Retention
+        || isDecoderFault(model) || isNeighborhoodFault(model);
+}
+
+// Структура для описания внедренной неисправности
+struct InjectedFault {
+    FaultModel model = FaultModel::None;
+    size_t addr = 0;
+    size_t len = 1;
+    // Probability field usage depends on fault model:
+    // - BitFlip: probability of flipping each bit (per-bit probability)
+    // - StuckAt0/StuckAt1/OpenRead: probability of applying fault at address level (per-address probability)
+    double flip_probability = 0.01;
+    // Seed of the counter-based RNG: random outcomes are a pure function of
+    // (seed, model, fault address, cell address, read pass), so a run can be reproduced
+    // exactly from the logged seed and same-seed faults of other models or ranges differ
+    uint64_t seed = 0;
+    // Coupling faults: victim addr + i is coupled to aggressor aggressor_addr + i (i < len).
+    // A transition is a write that changes the aggressor to trigger_value from another value.
+    // Coupling faults are deterministic: flip_probability and seed are not used.
+    size_t aggressor_addr = 0;
+    Word trigger_value = ~0u;
+    Word forced_value = 0;
+    // Retention faults: a cell not written for retention_ticks ticks of the simulated clock
+    // (see FaultInjector::advanceClock) reads as forced_value until it is written again.
+    // Transition and retention faults are deterministic as well.
+    uint64_t retention_ticks = DEFAULT_RETENTION_TICKS;
+    // Address decoder faults: address addr + i selects cell target_addr + i (AddressRemap,
+    // AddressMulti); AddressNoCell reads forced_value. Deterministic.
+    size_t target_addr = 0;
+    // Neighborhood faults: base cell addr + i depends on its 4 (north, south, west, east) or 8
+    // physical neighbors; the pattern is every neighbor holding trigger_value. Deterministic.
+    int neighborhood = 4;
+};
+
+// Режим выполнения теста
+enum class TestExecutionMode {
+    Visual,  // Демонстрация: пошаговая анимация с задержкой VISUALIZATION_DELAY_MS
+    Turbo    // Полная скорость: без задержек, прогресс по времени
+};
+
+#endif // TYPES_H
+
@@ -0,0 +1,15 @@
+#include <QCoreApplication>
+
+// One test object per tst_*.cpp file, run in turn in one executable
+int runMarchParserTest(int argc, char** argv);
+int runFaultOverlayTest(int argc, char** argv);
+int runFaultModelsTest(int argc, char** argv);
+
+int main(int argc, char** argv) {
+    QCoreApplication app(argc, argv);
+    int failed = 0;
+    failed += runMarchParserTest(argc, argv);
+    failed += runFaultOverlayTest(argc, argv);
+    failed += runFaultModelsTest(argc, argv);
+    return failed;
+}
@@ -0,0 +1,26 @@
+#-------------------------------------------------
+#
+# QtTest checks of the simulation engine.
+# "make check" runs them (CONFIG += testcase).
+#
+#-------------------------------------------------
+
+QT += core testlib
+QT -= gui
+
+CONFIG += c++11 console testcase
+CONFIG -= app_bundle
+
+TARGET = RAM_clone_tests
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+# Simulation engine (static library, no widgets)
+include(../core/core.pri)
+
+SOURCES += \
+    main.cpp \
+    tst_faultmodels.cpp \
+    tst_faultoverlay.cpp \
+    tst_marchparser.cpp
@@ -0,0 +1,279 @@
+#include <QtTest>
+#include "marchtest.h"
+#include "memorymodel.h"
+#include "memorytester.h"
+
+// Write-path and time-dependent fault models: each one is injected into a small
+// MemoryModel, triggered by a write (or the simulated clock), and the cell it acts on
+// is read back. The detection cases run the built-in algorithm whose description (or
+// the README, for NPSF) claims the model and expect the faulty address among the failures.
+class FaultModelsTest : public QObject {
+    Q_OBJECT
+
+private:
+    static const size_t WORDS = 256;   // 16 rows of DEFAULT_TOPOLOGY_COLUMNS
+    static const size_t FAULTY = 100;  // Victim, decoded address or base cell of the detection cases
+    static const size_t OTHER = 180;   // Aggressor or remap target of the detection cases
+
+    static InjectedFault fault(FaultModel model, size_t addr) {
+        InjectedFault f;
+        f.model = model;
+        f.addr = addr;
+        f.len = 1;
+        return f;
+    }
+
+    static TestResultsPtr runAlgorithm(MemoryModel& memory, const QString& id) {
+        TestResultsPtr results;
+        const MarchAlgorithm* algo = MarchLibrary::find(id);
+        if (!algo) return results;
+        // No event loop: finished() is delivered synchronously from runTest()
+        MemoryTester tester(&memory);
+        QObject::connect(&tester, &MemoryTester::finished, [&results](const TestResultsPtr& r) {
+            results = r;
+        });
+        tester.runTest(*algo, TestExecutionMode::Turbo, 1);
+        return results;
+    }
+
+private slots:
+    void couplingInversion() {
+        MemoryModel memory(WORDS);
+        InjectedFault f = fault(FaultModel::CouplingInversion, 10);
+        f.aggressor_addr = 20;
+        f.trigger_value = 0x5;
+        memory.injectFault(f);
+
+        memory.write(10, 0x1);
+        memory.write(20, 0x5);
+        QCOMPARE(memory.read(10), Word(~0x1u));
+        memory.write(20, 0x5); // No transition of the aggressor
+        QCOMPARE(memory.read(10), Word(~0x1u));
+        memory.write(20, 0x0);
+        memory.write(20, 0x5);
+        QCOMPARE(memory.read(10), Word(0x1));
+    }
+
+    void couplingIdempotent() {
+        MemoryModel memory(WORDS);
+        InjectedFault f = fault(FaultModel::CouplingIdempotent, 10);
+        f.aggressor_addr = 20;
+        f.trigger_value = 0x5;
+        f.forced_value = 0xAA;
+        memory.injectFault(f);
+
+        memory.write(10, 0x1);
+        memory.write(20, 0x4);
+        QCOMPARE(memory.read(10), Word(0x1));
+        memory.write(20, 0x5);
+        QCOMPARE(memory.read(10), Word(0xAA));
+    }
+
+    void couplingState() {
+        MemoryModel memory(WORDS);
+        InjectedFault f = fault(FaultModel::CouplingState, 10);
+        f.aggressor_addr = 20;
+        f.trigger_value = 0x5;
+        f.forced_value = 0xAA;
+        memory.injectFault(f);
+
+        memory.write(10, 0x1);
+        QCOMPARE(memory.read(10), Word(0x1));
+        memory.write(20, 0x5);
+        QCOMPARE(memory.read(10), Word(0xAA));
+    }
+
+    void transitionUp() {
+        MemoryModel memory(WORDS);
+        memory.injectFault(fault(FaultModel::TransitionUp, 5));
+        memory.write(5, 0xF0);
+        QCOMPARE(memory.read(5), Word(0)); // 0 -> 1 transitions are lost
+    }
+
+    void transitionDown() {
+        MemoryModel memory(WORDS);
+        memory.injectFault(fault(FaultModel::TransitionDown, 5));
+        memory.write(5, 0xFF);
+        memory.write(5, 0x0F);
+        QCOMPARE(memory.read(5), Word(0xFF)); // 1 -> 0 transitions are lost
+    }
+
+    void retention() {
+        MemoryModel memory(WORDS);
+        InjectedFault f = fault(FaultModel::Retention, 7);
+        f.retention_ticks = 10;
+        f.forced_value = 0xAB;
+        memory.injectFault(f);
+
+        memory.write(7, 0x55);
+        memory.advanceClock(9);
+        QCOMPARE(memory.read(7), Word(0x55));
+        memory.advanceClock(1);
+        QCOMPARE(memory.read(7), Word(0xAB));
+        memory.write(7, 0x66); // A write restarts the timer
+        QCOMPARE(memory.read(7), Word(0x66));
+    }
+
+    void retentionSurvivesOtherInjections() {
+        MemoryModel memory(WORDS);
+        InjectedFault f = fault(FaultModel::Retention, 7);
+        f.retention_ticks = 10;
+        f.forced_value = 0xAB;
+        memory.injectFault(f);
+        memory.write(7, 0x55);
+        memory.advanceClock(10);
+
+        memory.injectFault(fault(FaultModel::TransitionUp, 30));
+        QCOMPARE(memory.read(7), Word(0xAB));
+        QVERIFY(memory.removeFault(1));
+        QCOMPARE(memory.read(7), Word(0xAB));
+    }
+
+    void addressNoCell() {
+        MemoryModel memory(WORDS);
+        InjectedFault f = fault(FaultModel::AddressNoCell, 50);
+        f.forced_value = 0x99;
+        memory.injectFault(f);
+
+        memory.write(50, 0x1);
+        Word words[3];
+        QVERIFY(memory.readRange(49, words, 3));
+        QCOMPARE(words[0], Word(0));
+        QCOMPARE(words[1], Word(0x99));
+        QCOMPARE(words[2], Word(0));
+    }
+
+    void addressRemap() {
+        MemoryModel memory(WORDS);
+        InjectedFault f = fault(FaultModel::AddressRemap, 10);
+        f.target_addr = 20;
+        memory.injectFault(f);
+
+        memory.write(10, 0x7);
+        QCOMPARE(memory.read(20), Word(0x7));
+        QCOMPARE(memory.read(10), Word(0x7));
+        memory.write(20, 0x8);
+        QCOMPARE(memory.read(10), Word(0x8));
+    }
+
+    void addressMulti() {
+        MemoryModel memory(WORDS);
+        InjectedFault f = fault(FaultModel::AddressMulti, 30);
+        f.target_addr = 40;
+        memory.injectFault(f);
+
+        memory.write(40, 0xF0);
+        memory.write(30, 0xFF); // Written to both cells
+        QCOMPARE(memory.read(40), Word(0xFF));
+        memory.write(40, 0x0F);
+        QCOMPARE(memory.read(30), Word(0x0F)); // AND of both cells
+    }
+
+    // Base cell 17 of a 16-column matrix: neighbors 1, 33 (column) and 16, 18 (row)
+    void neighborhoodActive() {
+        MemoryModel memory(WORDS);
+        InjectedFault f = fault(FaultModel::NeighborhoodActive, 17);
+        f.neighborhood = 4;
+        f.trigger_value = 0x5;
+        memory.injectFault(f);
+
+        memory.write(17, 0x1);
+        memory.write(1, 0x5);
+        memory.write(33, 0x5);
+        memory.write(16, 0x5);
+        QCOMPARE(memory.read(17), Word(0x1));
+        memory.write(18, 0x5); // Completes the pattern
+        QCOMPARE(memory.read(17), Word(~0x1u));
+    }
+
+    void neighborhoodPassive() {
+        MemoryModel memory(WORDS);
+        InjectedFault f = fault(FaultModel::NeighborhoodPassive, 17);
+        f.neighborhood = 4;
+        f.trigger_value = 0x5;
+        memory.injectFault(f);
+
+        memory.write(17, 0x1);
+        for (size_t neighbor : {1, 33, 16, 18}) memory.write(neighbor, 0x5);
+        memory.write(17, 0x3); // Lost while the pattern is present
+        QCOMPARE(memory.read(17), Word(0x1));
+        memory.write(18, 0x0);
+        memory.write(17, 0x3);
+        QCOMPARE(memory.read(17), Word(0x3));
+    }
+
+    void neighborhoodStatic() {
+        MemoryModel memory(WORDS);
+        InjectedFault f = fault(FaultModel::NeighborhoodStatic, 17);
+        f.neighborhood = 4;
+        f.trigger_value = 0x5;
+        f.forced_value = 0xAA;
+        memory.injectFault(f);
+
+        memory.write(17, 0x1);
+        memory.write(1, 0x5);
+        memory.write(33, 0x5);
+        memory.write(16, 0x5);
+        QCOMPARE(memory.read(17), Word(0x1));
+        memory.write(18, 0x5);
+        QCOMPARE(memory.read(17), Word(0xAA));
+        memory.write(17, 0x3); // Held while the pattern is present
+        QCOMPARE(memory.read(17), Word(0xAA));
+    }
+
+    void detection_data() {
+        QTest::addColumn<int>("model");
+        QTest::addColumn<uint>("value"); // trigger_value, or forced_value of DRF
+        QTest::addColumn<QString>("algorithm");
+        const uint ones = ~0u;
+        QTest::newRow("CFin, March C-") << int(FaultModel::CouplingInversion) << ones << QString("march-c-minus");
+        QTest::newRow("CFin, March X") << int(FaultModel::CouplingInversion) << ones << QString("march-x");
+        QTest::newRow("CFid, March C-") << int(FaultModel::CouplingIdempotent) << ones << QString("march-c-minus");
+        QTest::newRow("CFst, March C-") << int(FaultModel::CouplingState) << 0u << QString("march-c-minus");
+        QTest::newRow("TF up, March X") << int(FaultModel::TransitionUp) << 0u << QString("march-x");
+        QTest::newRow("TF down, March C-") << int(FaultModel::TransitionDown) << 0u << QString("march-c-minus");
+        QTest::newRow("DRF to 0, March G") << int(FaultModel::Retention) << 0u << QString("march-g");
+        QTest::newRow("DRF to 1, March G") << int(FaultModel::Retention) << ones << QString("march-g");
+        QTest::newRow("AF no cell, MATS+") << int(FaultModel::AddressNoCell) << 0u << QString("mats-plus");
+        QTest::newRow("AF remap, March C-") << int(FaultModel::AddressRemap) << 0u << QString("march-c-minus");
+        QTest::newRow("AF multi, March C-") << int(FaultModel::AddressMulti) << 0u << QString("march-c-minus");
+        QTest::newRow("ANPSF, March C-") << int(FaultModel::NeighborhoodActive) << ones << QString("march-c-minus");
+        QTest::newRow("SNPSF, March C-") << int(FaultModel::NeighborhoodStatic) << ones << QString("march-c-minus");
+    }
+
+    void detection() {
+        QFETCH(int, model);
+        QFETCH(uint, value);
+        QFETCH(QString, algorithm);
+        MemoryModel memory(WORDS);
+        InjectedFault f = fault(FaultModel(model), FAULTY);
+        f.aggressor_addr = OTHER;
+        f.target_addr = OTHER;
+        f.trigger_value = value;
+        f.forced_value = f.model == FaultModel::Retention ? value : ~value;
+        f.neighborhood = 4;
+        memory.injectFault(f);
+
+        TestResultsPtr results = runAlgorithm(memory, algorithm);
+        QVERIFY(results);
+        QVERIFY(!results->cancelled());
+        QVERIFY2(results->isFailed(FAULTY), qPrintable(QString("%1 failed addresses").arg(results->failedCount())));
+    }
+
+    // Without delays the retention time is never reached: March B has no Del element
+    void retentionNeedsDelay() {
+        MemoryModel memory(WORDS);
+        InjectedFault f = fault(FaultModel::Retention, FAULTY);
+        memory.injectFault(f);
+        TestResultsPtr results = runAlgorithm(memory, "march-b");
+        QVERIFY(results);
+        QCOMPARE(results->failedCount(), size_t(0));
+    }
+};
+
+int runFaultModelsTest(int argc, char** argv) {
+    FaultModelsTest test;
+    return QTest::qExec(&test, argc, argv);
+}
+
+#include "tst_faultmodels.moc"
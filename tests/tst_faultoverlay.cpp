@@ -0,0 +1,145 @@
+#include <QtTest>
+#include <random>
+#include <vector>
+#include "comparekernel.h"
+#include "constants.h"
+#include "faultinjector.h"
+
+// Compiled read overlay: segments whose faults all have a fixed read effect are read
+// through one AND/XOR mask pair (FaultSet::Segment) instead of per-fault dispatch.
+// Random mixes of such faults must read exactly as applying every fault in injection
+// order, and every CompareKernel variant must agree with the scalar definition.
+class FaultOverlayTest : public QObject {
+    Q_OBJECT
+
+private:
+    static const size_t WORDS = 1024;
+
+    // Read effect of one fault at probability 0 or 1, written out per model
+    static Word applyReference(const InjectedFault& f, Word v) {
+        if (f.flip_probability < 1.0) return v;
+        switch (f.model) {
+            case FaultModel::StuckAt0: return 0u;
+            case FaultModel::StuckAt1: return static_cast<Word>(~0u);
+            case FaultModel::OpenRead: return INVALID_READ_MARKER;
+            case FaultModel::BitFlip: return ~v;
+            default: return v;
+        }
+    }
+
+    static std::vector<InjectedFault> randomFaults(std::mt19937& rng) {
+        const FaultModel models[] = {FaultModel::StuckAt0, FaultModel::StuckAt1, FaultModel::OpenRead,
+                                     FaultModel::BitFlip};
+        std::vector<InjectedFault> faults(1 + rng() % 12);
+        for (InjectedFault& f : faults) {
+            f.model = models[rng() % 4];
+            f.addr = rng() % (WORDS - 100);
+            f.len = 1 + rng() % std::min<size_t>(200, WORDS - f.addr);
+            f.flip_probability = rng() % 4 == 0 ? 0.0 : 1.0;
+            f.seed = rng();
+        }
+        return faults;
+    }
+
+    CompareKernel::Isa _initialIsa;
+
+private slots:
+    void initTestCase() { _initialIsa = CompareKernel::isa(); }
+    void cleanupTestCase() { CompareKernel::setIsa(_initialIsa); }
+
+    void overlayMatchesInjectionOrder_data() {
+        QTest::addColumn<uint>("seed");
+        for (uint seed = 1; seed <= 50; ++seed) QTest::newRow(qPrintable(QString("mix %1").arg(seed))) << seed;
+    }
+
+    void overlayMatchesInjectionOrder() {
+        QFETCH(uint, seed);
+        std::mt19937 rng(seed);
+        const std::vector<InjectedFault> faults = randomFaults(rng);
+        FaultInjector injector;
+        for (const InjectedFault& f : faults) injector.injectFault(f);
+
+        std::vector<Word> stored(WORDS);
+        for (Word& w : stored) w = rng();
+        std::vector<Word> expected = stored;
+        for (const InjectedFault& f : faults) {
+            for (size_t a = f.addr; a < f.addr + f.len; ++a) expected[a] = applyReference(f, expected[a]);
+        }
+
+        // Every segment has a fixed effect, so the whole range takes the mask path
+        std::shared_ptr<const FaultSnapshot> snap = injector.snapshot();
+        for (size_t a = 0; a < WORDS; ++a) {
+            const FaultSet::Segment* seg = snap->faults.segmentAt(a);
+            if (seg) QVERIFY(seg->masked);
+        }
+
+        std::vector<Word> words = stored;
+        injector.applyFaultRange(0, words.data(), words.size(), 3);
+        for (size_t a = 0; a < WORDS; ++a) QCOMPARE(words[a], expected[a]);
+
+        // Ranges that start and end inside segments
+        for (int round = 0; round < 20; ++round) {
+            size_t begin = rng() % WORDS;
+            size_t count = rng() % (WORDS - begin + 1);
+            std::vector<Word> part(stored.begin() + begin, stored.begin() + begin + count);
+            injector.applyFaultRange(begin, part.data(), part.size(), 3);
+            for (size_t i = 0; i < count; ++i) QCOMPARE(part[i], expected[begin + i]);
+        }
+
+        injector.setReadPass(3);
+        for (size_t a = 0; a < WORDS; ++a) QCOMPARE(injector.applyFault(a, stored[a]), expected[a]);
+    }
+
+    void kernelMatchesScalar_data() {
+        QTest::addColumn<int>("isa");
+        QTest::newRow("scalar") << int(CompareKernel::Isa::Scalar);
+        QTest::newRow("sse2") << int(CompareKernel::Isa::Sse2);
+        QTest::newRow("avx2") << int(CompareKernel::Isa::Avx2);
+        QTest::newRow("avx512") << int(CompareKernel::Isa::Avx512);
+    }
+
+    void kernelMatchesScalar() {
+        QFETCH(int, isa);
+        if (!CompareKernel::setIsa(CompareKernel::Isa(isa))) QSKIP("Not supported by this CPU or build");
+
+        std::mt19937 rng(uint(isa) + 1);
+        const CompareKernel::Pattern pattern = CompareKernel::pattern([](size_t a) {
+            return Word(a * 0x9E3779B9u);
+        });
+        const size_t counts[] = {0, 1, 7, 8, 15, 16, 31, 63, 64, 65, 127, 1000, 4097};
+        for (size_t count : counts) {
+            const size_t begin = rng() % 100;
+            std::vector<Word> data(count);
+            for (size_t i = 0; i < count; ++i) {
+                Word expected = pattern.words[(begin + i) % CompareKernel::PERIOD];
+                data[i] = rng() % 3 == 0 ? expected ^ (1u << (rng() % BITS_PER_WORD)) : expected;
+            }
+
+            std::vector<quint64> mismatches(CompareKernel::maskWords(count) + 1, ~quint64(0));
+            size_t found = CompareKernel::compare(data.data(), count, begin, pattern, mismatches.data());
+            size_t expectedFound = 0;
+            for (size_t i = 0; i < count; ++i) {
+                const bool differs = data[i] != pattern.words[(begin + i) % CompareKernel::PERIOD];
+                expectedFound += differs;
+                QCOMPARE(bool((mismatches[i / 64] >> (i % 64)) & 1u), differs);
+            }
+            QCOMPARE(found, expectedFound);
+            for (size_t i = count; i < CompareKernel::maskWords(count) * 64; ++i) {
+                QVERIFY(!((mismatches[i / 64] >> (i % 64)) & 1u));
+            }
+            QCOMPARE(mismatches.back(), ~quint64(0)); // Nothing written past maskWords(count)
+
+            const Word andMask = rng(), xorMask = rng();
+            std::vector<Word> masked = data;
+            CompareKernel::applyMask(masked.data(), count, andMask, xorMask);
+            for (size_t i = 0; i < count; ++i) QCOMPARE(masked[i], (data[i] & andMask) ^ xorMask);
+        }
+    }
+};
+
+int runFaultOverlayTest(int argc, char** argv) {
+    FaultOverlayTest test;
+    return QTest::qExec(&test, argc, argv);
+}
+
+#include "tst_faultoverlay.moc"
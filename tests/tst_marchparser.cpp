@@ -0,0 +1,102 @@
+#include <QtTest>
+#include <vector>
+#include "constants.h"
+#include "marchtest.h"
+
+// March notation parser: built-in notations survive a parse/format round trip,
+// alternative spellings parse to the same elements, and malformed input is
+// rejected with the position of the first error.
+class MarchParserTest : public QObject {
+    Q_OBJECT
+
+private:
+    static QString formatted(const QString& notation) {
+        std::vector<MarchElement> elements;
+        QString error;
+        if (!MarchParser::parse(notation, elements, &error)) return QString("error: %1").arg(error);
+        return MarchParser::format(elements);
+    }
+
+private slots:
+    void builtinRoundTrip_data() {
+        QTest::addColumn<QString>("id");
+        for (const MarchAlgorithm& algo : MarchLibrary::algorithms()) {
+            QTest::newRow(qPrintable(algo.id)) << algo.id;
+        }
+    }
+
+    void builtinRoundTrip() {
+        QFETCH(QString, id);
+        const MarchAlgorithm* algo = MarchLibrary::find(id);
+        QVERIFY(algo != nullptr);
+        QVERIFY(!algo->elements.empty());
+
+        std::vector<MarchElement> elements;
+        QString error;
+        QVERIFY2(MarchParser::parse(algo->notation, elements, &error), qPrintable(error));
+        QCOMPARE(elements.size(), algo->elements.size());
+        for (size_t i = 0; i < elements.size(); ++i) {
+            QCOMPARE(MarchParser::formatElement(elements[i]), MarchParser::formatElement(algo->elements[i]));
+            QCOMPARE(elements[i].delay, algo->elements[i].delay);
+        }
+        QCOMPARE(MarchParser::format(elements), algo->notation);
+    }
+
+    void alternativeSpellings_data() {
+        QTest::addColumn<QString>("notation");
+        QTest::addColumn<QString>("expected");
+        const QString marchX = QString::fromUtf8("{⇕(w0); ⇑(r0,w1); ⇓(r1,w0); ⇕(r0)}");
+        QTest::newRow("keywords") << QString("{any(w0); up(r0,w1); down(r1,w0); any(r0)}") << marchX;
+        QTest::newRow("upper case") << QString("{ANY(W0); Up(R0,W1); DOWN(r1,w0); Any(r0)}") << marchX;
+        QTest::newRow("no braces") << QString::fromUtf8("⇕(w0);⇑(r0,w1);⇓(r1,w0);⇕(r0)") << marchX;
+        QTest::newRow("single arrows") << QString::fromUtf8("{↕(w0); ↑(r0, w1); ↓(r1, w0); ↕(r0)}") << marchX;
+        QTest::newRow("default delay") << QString("{up(w0); del; up(r0)}") << QString::fromUtf8("{⇑(w0); Del; ⇑(r0)}");
+        QTest::newRow("explicit delay") << QString("{up(w0); DEL(25); up(r0)}")
+                                        << QString::fromUtf8("{⇑(w0); Del(25); ⇑(r0)}");
+        QTest::newRow("delay of the default length")
+            << QString("{up(w0); del(%1); up(r0)}").arg(DEFAULT_DELAY_TICKS)
+            << QString::fromUtf8("{⇑(w0); Del; ⇑(r0)}");
+    }
+
+    void alternativeSpellings() {
+        QFETCH(QString, notation);
+        QFETCH(QString, expected);
+        QCOMPARE(formatted(notation), expected);
+    }
+
+    void errors_data() {
+        QTest::addColumn<QString>("notation");
+        QTest::addColumn<QString>("expected");
+        QTest::newRow("empty") << QString() << QString("Позиция 1: ожидался порядок адресов");
+        QTest::newRow("empty braces") << QString("{}") << QString("Позиция 2: ожидался порядок адресов");
+        QTest::newRow("unknown order") << QString("{left(w0)}") << QString("Позиция 2: ожидался порядок адресов");
+        QTest::newRow("missing '('") << QString::fromUtf8("{⇑w0}") << QString("Позиция 3: ожидалась '('");
+        QTest::newRow("bad operation") << QString::fromUtf8("{⇑(r2)}") << QString("Позиция 4: ожидалась операция");
+        QTest::newRow("truncated operation") << QString::fromUtf8("{⇑(r") << QString("Позиция 4: ожидалась операция");
+        QTest::newRow("missing ')'") << QString::fromUtf8("{⇑(r0}") << QString("Позиция 6: ожидалась ')'");
+        QTest::newRow("missing '}'") << QString::fromUtf8("{⇑(r0)") << QString("Позиция 7: ожидалась '}'");
+        QTest::newRow("trailing text") << QString::fromUtf8("⇑(r0) x") << QString("Позиция 7: лишние символы");
+        QTest::newRow("zero delay") << QString("{Del(0)}") << QString("Позиция 7: ожидалась длительность задержки");
+        QTest::newRow("non-numeric delay") << QString("{Del(x)}") << QString("Позиция 6: ожидалась длительность задержки");
+        QTest::newRow("unclosed delay") << QString("{Del(5}") << QString("Позиция 7: ожидалась ')'");
+    }
+
+    void errors() {
+        QFETCH(QString, notation);
+        QFETCH(QString, expected);
+        std::vector<MarchElement> elements;
+        QString error;
+        QVERIFY(!MarchParser::parse(notation, elements, &error));
+        QVERIFY2(error.startsWith(expected), qPrintable(error));
+
+        MarchAlgorithm algo;
+        QVERIFY(!MarchLibrary::compile("custom", notation, DataBackground::Solid, algo));
+    }
+};
+
+int runMarchParserTest(int argc, char** argv) {
+    MarchParserTest test;
+    return QTest::qExec(&test, argc, argv);
+}
+
+#include "tst_marchparser.moc"